@@ -19,6 +19,9 @@ INCLUDEPATH += .
 # C++17标准支持（试井模型需要）
 CONFIG += c++17
 
+# 求解器运行统计 (计数器与阶段计时，见 solverstats.h)；去掉此行则统计代码不编译进求解器
+DEFINES += WELLTEST_SOLVER_STATS
+
 # 编译优化选项
 QMAKE_CXXFLAGS += -O3
 QMAKE_CXXFLAGS_RELEASE -= -O2
@@ -50,19 +53,31 @@ include(D:/08YYYXXX/QXlsx-master/QXlsx/QXlsx.pri)
 
 # Input
 HEADERS += \
+           accuracyprofile.h \
+           besselbatch.h \
            chartsetting1.h \
            chartsetting2.h \
            chartwidget.h \
            chartwindow.h \
+           complexbessel.h \
            datacalculate.h \
            datacolumndialog.h \
            dataimportdialog.h \
            datasinglesheet.h \
+           fitengine.h \
            fittingdatadialog.h \
            fittingpage.h \
            fittingparameterchart.h \
+           fracturegeometry.h \
+           fracturegeometrydialog.h \
+           hmatrix.h \
+           laplaceinversion.h \
+           linesourceintegral.h \
+           logloginterpolator.h \
+           lrucache.h \
            modelmanager.h \
            modelparameter.h \
+           modelparams.h \
            modelselect.h \
            modelsolver01-06.h \
            mousezoom.h \
@@ -78,8 +93,12 @@ HEADERS += \
            plottingdialog4.h \
            pressurederivativecalculator.h \
            pressurederivativecalculator1.h \
+           reservoirresponsecache.h \
            settingswidget.h \
+           solverstats.h \
+           solverworkspace.h \
            qcustomplot.h \
+           typecurvecache.h \
            wt_datawidget.h \
            wt_fittingwidget.h \
            wt_modelwidget.h \
@@ -116,19 +135,30 @@ FORMS += \
          wt_projectwidget.ui
 
 SOURCES += \
+           accuracyprofile.cpp \
+           besselbatch.cpp \
            chartsetting1.cpp \
            chartsetting2.cpp \
            chartwidget.cpp \
            chartwindow.cpp \
+           complexbessel.cpp \
            datacalculate.cpp \
            datacolumndialog.cpp \
            dataimportdialog.cpp \
            datasinglesheet.cpp \
+           fitengine.cpp \
            fittingdatadialog.cpp \
            fittingpage.cpp \
            fittingparameterchart.cpp \
+           fracturegeometry.cpp \
+           fracturegeometrydialog.cpp \
+           hmatrix.cpp \
+           laplaceinversion.cpp \
+           linesourceintegral.cpp \
+           logloginterpolator.cpp \
            modelmanager.cpp \
            modelparameter.cpp \
+           modelparams.cpp \
            modelselect.cpp \
            modelsolver01-06.cpp \
            mousezoom.cpp \
@@ -145,8 +175,12 @@ SOURCES += \
            plottingdialog4.cpp \
            pressurederivativecalculator.cpp \
            pressurederivativecalculator1.cpp \
+           reservoirresponsecache.cpp \
            settingswidget.cpp \
+           solverstats.cpp \
+           solverworkspace.cpp \
            qcustomplot.cpp \
+           typecurvecache.cpp \
            wt_datawidget.cpp \
            wt_fittingwidget.cpp \
            wt_modelwidget.cpp \
@@ -0,0 +1,301 @@
+/*
+ * accuracyprofile.cpp
+ * 文件作用: 求解精度档位与自动标定实现
+ * 功能描述:
+ * 1. 各档位的默认设置与全局当前设置 (加锁读写)。
+ * 2. 标定: 参考求解 → 按各方法的候选阶梯逐个求解 → 比较误差与代价 (拉普拉斯求值次数)，选出满足目标的代价最小的设置。
+ */
+
+#include "accuracyprofile.h"
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QMutexLocker>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+QMutex g_profileMutex;
+bool g_profilesInit = false;
+AccuracySettings g_profiles[3];
+
+void ensureProfiles()
+{
+    if (g_profilesInit) return;
+    for (int i = 0; i < 3; ++i) g_profiles[i] = AccuracyProfiles::defaults((AccuracyProfile)i);
+    g_profilesInit = true;
+}
+
+// 影响系数积分的候选 (容差, 最大递归深度)，由松到紧
+const double kQuadTolerances[] = { 1e-3, 1e-4, 1e-5, 1e-6 };
+const int kQuadDepths[] = { 6, 8, 10, 12 };
+
+// 各反演方法的候选阶数 (由低到高；Stehfest 只取偶数阶，Euler 超过约 20 阶后舍入误差反而增大)
+QVector<int> orderLadder(InversionMethod method)
+{
+    switch (method) {
+    case InversionMethod::Talbot: return { 8, 12, 16, 24, 32 };
+    case InversionMethod::DeHoog: return { 4, 6, 8, 12, 16 };
+    case InversionMethod::Euler:  return { 6, 8, 11, 15, 19 };
+    case InversionMethod::Stehfest:
+    default:                      return { 4, 6, 8, 10, 12 };
+    }
+}
+
+// 参考解: 高阶 Talbot 围道。Stehfest 受双精度限制 (约 16 阶以上发散)，在导数快速变化段达不到 1e-4，不宜作参考
+const int kReferenceTalbotOrder = 32;
+const double kReferenceQuadTolerance = 1e-8;
+const int kReferenceQuadDepth = 14;
+
+// 参数是否包含需要数值积分的非共线裂缝段 (否则积分设置不影响结果，无需扫描；复平面反演的积分为固定分段，同样不扫描)
+bool needsQuadrature(const ModelParams& params)
+{
+    if (!params.geometry || params.geometry->isEmpty()) return false;
+    const QVector<double>& y = params.geometry->y();
+    for (int i = 1; i < y.size(); ++i) {
+        if (std::abs(y[i] - y[0]) > 1e-14) return true;
+    }
+    return false;
+}
+
+// 按对数均匀抽取不超过 maxPoints 个正时间点
+QVector<double> sampleTimes(const QVector<double>& times, int maxPoints)
+{
+    QVector<double> t;
+    for (double v : times) if (v > 0.0) t.append(v);
+    std::sort(t.begin(), t.end());
+    t.erase(std::unique(t.begin(), t.end()), t.end());
+    if (t.size() <= maxPoints) return t;
+
+    QVector<double> out;
+    double l0 = std::log(t.first()), l1 = std::log(t.last());
+    int last = -1;
+    for (int k = 0; k < maxPoints; ++k) {
+        double target = std::exp(l0 + (l1 - l0) * k / (maxPoints - 1));
+        int idx = (int)(std::lower_bound(t.begin(), t.end(), target) - t.begin());
+        idx = std::min(idx, (int)t.size() - 1);
+        if (idx > last) { out.append(t[idx]); last = idx; }
+    }
+    return out;
+}
+}
+
+SolverOptions AccuracySettings::apply(const SolverOptions& base) const
+{
+    SolverOptions options = base;
+    options.highPrecision = true; // 阶数由本组设置显式给出
+    options.inversion = inversion;
+    options.stehfestN = stehfestN;
+    options.stehfestMaxN = stehfestMaxN;
+    options.stehfestTolerance = stehfestTolerance;
+    options.inversionOrder = inversionOrder;
+    options.quadratureTolerance = quadratureTolerance;
+    options.quadratureMaxDepth = quadratureMaxDepth;
+    options.gridDensity = gridDensity;
+    options.asymptoticTolerance = asymptoticTolerance;
+    return options;
+}
+
+QString AccuracySettings::describe() const
+{
+    QString order = (inversion == InversionMethod::Stehfest)
+        ? ((stehfestMaxN > stehfestN) ? QString("N=%1~%2").arg(stehfestN).arg(stehfestMaxN) : QString("N=%1").arg(stehfestN))
+        : QString("阶数 %1").arg(inversionOrder);
+    return QString("%1 %2, 积分容差 %3 (深度 %4), 网格密度 %5%6%7")
+        .arg(InversionEngine::methodName(inversion)).arg(order)
+        .arg(quadratureTolerance, 0, 'g', 2).arg(quadratureMaxDepth)
+        .arg(gridDensity, 0, 'g', 3)
+        .arg(asymptoticTolerance > 0.0 ? QString(", 渐近段容差 %1").arg(asymptoticTolerance, 0, 'g', 2) : QString())
+        .arg(calibrated ? QString(", 已标定") : QString());
+}
+
+// 报告档位与原高精度模式一致 (不使用渐近段捷径)；拟合档位与原拟合迭代的低阶 Stehfest 一致，积分放宽一级；
+// 预览档位进一步放宽并减半网格。渐近段容差取各档位目标误差的 1/10
+AccuracySettings AccuracyProfiles::defaults(AccuracyProfile profile)
+{
+    AccuracySettings s;
+    switch (profile) {
+    case AccuracyProfile::Preview:
+        s.stehfestN = 4;
+        s.stehfestMaxN = 0;
+        s.quadratureTolerance = 1e-3;
+        s.quadratureMaxDepth = 6;
+        s.gridDensity = 0.5;
+        s.asymptoticTolerance = 1e-3;
+        s.targetError = 1e-2;
+        break;
+    case AccuracyProfile::Fit:
+        s.stehfestN = 4;
+        s.stehfestMaxN = 0;
+        s.quadratureTolerance = 1e-4;
+        s.quadratureMaxDepth = 8;
+        s.asymptoticTolerance = 1e-4;
+        s.targetError = 1e-3;
+        break;
+    case AccuracyProfile::Report:
+    default:
+        break;
+    }
+    return s;
+}
+
+AccuracySettings AccuracyProfiles::settings(AccuracyProfile profile)
+{
+    QMutexLocker locker(&g_profileMutex);
+    ensureProfiles();
+    return g_profiles[(int)profile];
+}
+
+void AccuracyProfiles::setSettings(AccuracyProfile profile, const AccuracySettings& settings)
+{
+    QMutexLocker locker(&g_profileMutex);
+    ensureProfiles();
+    g_profiles[(int)profile] = settings;
+}
+
+void AccuracyProfiles::resetAll()
+{
+    QMutexLocker locker(&g_profileMutex);
+    g_profilesInit = false;
+    ensureProfiles();
+}
+
+SolverOptions AccuracyProfiles::options(AccuracyProfile profile, const SolverOptions& base)
+{
+    return settings(profile).apply(base);
+}
+
+QString AccuracyProfiles::name(AccuracyProfile profile)
+{
+    switch (profile) {
+    case AccuracyProfile::Preview: return "预览";
+    case AccuracyProfile::Fit:     return "拟合";
+    case AccuracyProfile::Report:  return "报告";
+    }
+    return QString();
+}
+
+double AccuracyTuner::evaluationCost(const SolverStats& stats, const AccuracySettings& settings, int points)
+{
+    if (SolverStats::compiledIn()) {
+        double realEvaluations = (double)(stats.laplaceEvaluations - stats.complexEvaluations);
+        return realEvaluations + kComplexEvaluationCost * stats.complexEvaluations;
+    }
+    if (settings.inversion == InversionMethod::Stehfest) return (double)points * settings.stehfestN;
+    QSharedPointer<InversionEngine> engine = InversionEngine::create(settings.inversion, settings.inversionOrder);
+    return kComplexEvaluationCost * points * engine->evaluationsPerPoint();
+}
+
+double AccuracyTuner::relativeError(const ModelCurveData& curve, const ModelCurveData& reference)
+{
+    const QVector<double>& p = std::get<1>(curve);
+    const QVector<double>& d = std::get<2>(curve);
+    const QVector<double>& pRef = std::get<1>(reference);
+    const QVector<double>& dRef = std::get<2>(reference);
+    int n = std::min(p.size(), pRef.size());
+    if (n == 0 || d.size() < n || dRef.size() < n) return HUGE_VAL;
+
+    double pMax = 0.0, dMax = 0.0;
+    for (int k = 0; k < n; ++k) {
+        pMax = std::max(pMax, std::abs(pRef[k]));
+        dMax = std::max(dMax, std::abs(dRef[k]));
+    }
+    double pFloor = std::max(1e-3 * pMax, 1e-300), dFloor = std::max(1e-3 * dMax, 1e-300);
+
+    double err = 0.0;
+    for (int k = 0; k < n; ++k) {
+        if (!std::isfinite(p[k]) || !std::isfinite(d[k])) return HUGE_VAL;
+        err = std::max(err, std::abs(p[k] - pRef[k]) / std::max(std::abs(pRef[k]), pFloor));
+        err = std::max(err, std::abs(d[k] - dRef[k]) / std::max(std::abs(dRef[k]), dFloor));
+    }
+    return err;
+}
+
+AccuracyTuner::Result AccuracyTuner::calibrate(const ModelSolver01_06& solver, const ModelParams& params, const QVector<double>& times,
+                                               AccuracyProfile profile)
+{
+    AccuracySettings current = AccuracyProfiles::settings(profile);
+    QVector<InversionMethod> methods = { InversionMethod::Stehfest, InversionMethod::Talbot,
+                                         InversionMethod::DeHoog, InversionMethod::Euler };
+    return calibrate(solver, params, times, current.targetError, methods, current);
+}
+
+AccuracyTuner::Result AccuracyTuner::calibrate(const ModelSolver01_06& solver, const ModelParams& params, const QVector<double>& times,
+                                               double targetError, const QVector<InversionMethod>& methods,
+                                               const AccuracySettings& base)
+{
+    Result result;
+    QVector<double> t = sampleTimes(times, kMaxSamplePoints);
+
+    // 候选设置 (求解选项不含缓存，每次都完整求解；统计只记入本候选的局部记录，用于计算代价)
+    auto settingsFor = [&](InversionMethod method, int order, double quadTol, int quadDepth) {
+        bool stehfest = (method == InversionMethod::Stehfest);
+        AccuracySettings s = base;
+        s.inversion = method;
+        s.stehfestN = stehfest ? order : 0;
+        s.stehfestMaxN = 0;
+        s.inversionOrder = stehfest ? 0 : order;
+        s.quadratureTolerance = quadTol;
+        s.quadratureMaxDepth = quadDepth;
+        s.targetError = targetError;
+        s.calibrated = true;
+        return s;
+    };
+
+    AccuracySettings refSettings = settingsFor(InversionMethod::Talbot, kReferenceTalbotOrder,
+                                               kReferenceQuadTolerance, kReferenceQuadDepth);
+    // 求解一个候选，返回曲线并给出代价与耗时
+    QElapsedTimer timer;
+    auto solve = [&](const AccuracySettings& s, double& cost, double& ms) {
+        SolverStats stats;
+        SolverOptions options = s.apply();
+        options.stats = &stats;
+        timer.restart();
+        ModelCurveData curve = solver.calculateTheoreticalCurve(params, t, options);
+        ms = timer.nsecsElapsed() * 1e-6;
+        cost = evaluationCost(stats, s, t.size());
+        return curve;
+    };
+    timer.start();
+    ModelCurveData reference = solve(refSettings, result.referenceCost, result.referenceMs);
+
+    // 积分候选: Stehfest 求解非共线裂缝时由松到紧扫描，其余情况积分设置不起作用，保留 base 中的设置
+    QVector<QPair<double, int>> fixedQuad = { qMakePair(base.quadratureTolerance, base.quadratureMaxDepth) };
+    QVector<QPair<double, int>> quadScan;
+    for (int q = 0; q < (int)(sizeof(kQuadTolerances) / sizeof(kQuadTolerances[0])); ++q)
+        quadScan.append(qMakePair(kQuadTolerances[q], kQuadDepths[q]));
+    bool scanQuad = needsQuadrature(params);
+
+    result.settings = refSettings;
+    result.error = HUGE_VAL;
+    for (InversionMethod method : methods) {
+        const QVector<QPair<double, int>>& quadLadder =
+            (scanQuad && method == InversionMethod::Stehfest) ? quadScan : fixedQuad;
+        bool methodDone = false;
+        // 阶数由低到高，同一方法中首个满足目标的阶数即为该方法代价最小的设置；
+        // 已有满足目标的候选时，代价超过它的候选之后的更高阶数代价只会更大，不再尝试
+        for (int order : orderLadder(method)) {
+            // 同一阶数下积分由松到紧，首个满足目标的即为该阶数代价最小的设置
+            for (const QPair<double, int>& quad : quadLadder) {
+                AccuracySettings s = settingsFor(method, order, quad.first, quad.second);
+                double cost = 0.0, ms = 0.0;
+                ModelCurveData curve = solve(s, cost, ms);
+                double err = relativeError(curve, reference);
+                ++result.candidates;
+
+                bool met = (err <= targetError);
+                // 满足目标的候选比代价；都未满足时保留误差最小者
+                if (met ? (!result.met || cost < result.cost) : (!result.met && err < result.error)) {
+                    result.settings = s;
+                    result.error = err;
+                    result.cost = cost;
+                    result.elapsedMs = ms;
+                    result.met = met;
+                }
+                if (met || (result.met && cost > result.cost)) { methodDone = true; break; }
+            }
+            if (methodDone) break;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,99 @@
+/*
+ * accuracyprofile.h
+ * 文件作用: 求解精度档位与自动标定头文件
+ * 功能描述:
+ * 1. AccuracyProfile 定义三个命名精度档位: 预览 (界面快速浏览)、拟合 (迭代与雅可比)、报告 (最终曲线与导出)。
+ * 2. AccuracySettings 把反演阶数、影响系数积分容差与递归深度、典型曲线网格密度与渐近段捷径容差作为一组设置，
+ *    AccuracyProfiles 保存各档位的当前设置 (全局、线程安全)，并据此生成 SolverOptions。
+ * 3. AccuracyTuner 对给定参数与时间序列做一次高精度参考求解，在各反演方法的候选阶数与积分设置中
+ *    选出满足档位目标相对误差且代价最小的一组。代价为拉普拉斯核函数求值次数 (复数求值按固定倍数折算)，
+ *    与机器负载无关，同样的输入总是选出同样的设置。标定较慢，由界面按需调用 (拟合页"标定精度")，结果写入档位设置。
+ */
+
+#ifndef ACCURACYPROFILE_H
+#define ACCURACYPROFILE_H
+
+#include <QString>
+#include <QVector>
+#include "modelsolver01-06.h"
+
+// 命名精度档位
+enum class AccuracyProfile {
+    Preview = 0, // 预览: 界面快速浏览，误差约 1e-2
+    Fit,         // 拟合: 迭代残差与雅可比，误差约 1e-3
+    Report       // 报告: 最终曲线与导出，误差约 1e-4 (与原高精度模式一致)
+};
+
+// 一个档位的求解设置 (各字段含义与 SolverOptions 中的同名字段相同)
+struct AccuracySettings {
+    InversionMethod inversion = InversionMethod::Stehfest;
+    int stehfestN = 8;
+    int stehfestMaxN = 16;
+    double stehfestTolerance = 1e-6;
+    int inversionOrder = 0;
+    double quadratureTolerance = 1e-5;
+    int quadratureMaxDepth = 10;
+    double gridDensity = 1.0;
+    double asymptoticTolerance = 0.0;
+    double targetError = 1e-4;  // 档位的目标相对误差
+    bool calibrated = false;    // 是否由 AccuracyTuner 标定
+
+    // 把本组设置写入 base 的精度相关字段 (缓存模式、统计等其余字段保持不变)
+    SolverOptions apply(const SolverOptions& base = SolverOptions()) const;
+    // 界面显示用的单行描述
+    QString describe() const;
+};
+
+class AccuracyProfiles
+{
+public:
+    // 档位的默认设置
+    static AccuracySettings defaults(AccuracyProfile profile);
+    // 档位的当前设置 (未修改时为默认设置)
+    static AccuracySettings settings(AccuracyProfile profile);
+    static void setSettings(AccuracyProfile profile, const AccuracySettings& settings);
+    // 全部档位恢复默认设置
+    static void resetAll();
+
+    // 按档位当前设置生成求解选项
+    static SolverOptions options(AccuracyProfile profile, const SolverOptions& base = SolverOptions());
+
+    static QString name(AccuracyProfile profile);
+};
+
+class AccuracyTuner
+{
+public:
+    struct Result {
+        AccuracySettings settings; // 选出的设置 (未满足目标时为误差最小的候选)
+        double error = 0.0;        // 选出设置相对参考解的最大相对误差
+        double cost = 0.0;         // 选出设置的代价 (见 evaluationCost，候选按此比较)
+        double referenceCost = 0.0; // 参考求解的代价
+        double elapsedMs = 0.0;    // 选出设置的单次求解耗时 (仅供显示，不参与比较)
+        double referenceMs = 0.0;  // 参考求解耗时 (仅供显示)
+        int candidates = 0;        // 实际求解的候选数
+        bool met = false;          // 是否满足目标误差
+    };
+
+    // 在 params、times 上为 profile 标定设置 (全部反演方法参与比较，网格密度沿用档位当前设置)；
+    // 时间点很多时按对数均匀抽取不超过 kMaxSamplePoints 个点进行比较
+    static Result calibrate(const ModelSolver01_06& solver, const ModelParams& params, const QVector<double>& times,
+                            AccuracyProfile profile);
+    // 同上，按显式给出的目标误差与候选反演方法标定，未标定的字段取自 base
+    static Result calibrate(const ModelSolver01_06& solver, const ModelParams& params, const QVector<double>& times,
+                            double targetError, const QVector<InversionMethod>& methods,
+                            const AccuracySettings& base = AccuracySettings());
+
+    // 压力与导数相对参考解的最大相对误差 (导数按其最大值的 1e-3 设下限，避免早期近零值放大误差)
+    static double relativeError(const ModelCurveData& curve, const ModelCurveData& reference);
+
+    // 一次求解的代价: 拉普拉斯核函数求值次数，复数求值折算为 kComplexEvaluationCost 次实数求值；
+    // 统计未编译进求解器 (WELLTEST_SOLVER_STATS) 时按 settings 的每点名义求值次数乘以时间点数估计
+    static double evaluationCost(const SolverStats& stats, const AccuracySettings& settings, int points);
+
+    static const int kMaxSamplePoints = 40;
+    // 一次复数核函数求值相当于实数求值的次数 (bench_inversion 中 Talbot 与 Stehfest 的每次求值耗时之比约为 10)
+    static constexpr double kComplexEvaluationCost = 10.0;
+};
+
+#endif // ACCURACYPROFILE_H
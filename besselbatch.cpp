@@ -0,0 +1,336 @@
+/*
+ * besselbatch.cpp
+ * 文件作用: 批量 Bessel 函数计算库实现
+ * 功能描述:
+ * 1. 分段 Chebyshev 逼近 (与 Cephes 的分段方式一致):
+ *    - e^{-x}I0, e^{-x}I1/x: x <= 8 关于 x 展开，x > 8 对 sqrt(x)·e^{-x}I 关于 8/x 展开；
+ *    - K0, K1: x <= 2 使用 -ln(x/2)·I + 光滑部分 (关于 x²/4 展开)，x > 2 对 sqrt(x)·e^x·K 关于 2/x 展开。
+ * 2. Chebyshev 系数在首次调用时由 boost 的高精度函数值拟合得到，线程安全。
+ * 3. AVX2 路径一次处理 4 个参数：两段系数按掩码混合后做一次 Clenshaw 递推，
+ *    exp/log 使用向量化多项式实现；不支持 AVX2 的 CPU 自动使用标量实现。
+ */
+
+#include "besselbatch.h"
+
+#include <boost/math/special_functions/bessel.hpp>
+#include <cmath>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BESSELBATCH_HAS_AVX2 1
+#define BESSELBATCH_TARGET __attribute__((target("avx2,fma")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(__AVX2__)
+#define BESSELBATCH_HAS_AVX2 1
+#define BESSELBATCH_TARGET
+#include <immintrin.h>
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const int kChebLen = 32;          // 各段 Chebyshev 系数个数 (统一长度便于向量化混合)
+const double kSplitI = 8.0;       // I 函数分段点
+const double kSplitK = 2.0;       // K 函数分段点
+const double kAsymLimit = 700.0;  // 超过该值时用渐近展开生成拟合节点值 (避免 boost 溢出)
+
+std::atomic<bool> g_forceScalar(false);
+
+// 渐近展开系数 a_k(ν) = Π_{j=1..k} (4ν² - (2j-1)²) / (k! 8^k)
+double asymptoticSum(int nu, double x, bool alternate)
+{
+    double mu = 4.0 * nu * nu;
+    double term = 1.0, sum = 1.0;
+    for (int k = 1; k <= 12; ++k) {
+        term *= (mu - (2.0 * k - 1.0) * (2.0 * k - 1.0)) / (k * 8.0 * x);
+        sum += (alternate && (k % 2 == 1)) ? -term : term;
+    }
+    return sum;
+}
+
+// sqrt(x)·e^{-x}·I_ν(x)
+double scaledSqrtI(int nu, double x)
+{
+    if (x > kAsymLimit) return asymptoticSum(nu, x, true) / std::sqrt(2.0 * M_PI);
+    return boost::math::cyl_bessel_i(nu, x) * std::exp(-x) * std::sqrt(x);
+}
+
+// sqrt(x)·e^{x}·K_ν(x)
+double scaledSqrtK(int nu, double x)
+{
+    if (x > kAsymLimit) return asymptoticSum(nu, x, false) * std::sqrt(0.5 * M_PI);
+    return boost::math::cyl_bessel_k(nu, x) * std::exp(x) * std::sqrt(x);
+}
+
+// t ∈ [-1,1] 上的 Chebyshev 拟合
+template <typename F>
+std::vector<double> chebFit(F f)
+{
+    const int n = kChebLen;
+    std::vector<double> fv(n), c(n);
+    for (int k = 0; k < n; ++k) fv[k] = f(std::cos(M_PI * (k + 0.5) / n));
+    for (int j = 0; j < n; ++j) {
+        double s = 0.0;
+        for (int k = 0; k < n; ++k) s += fv[k] * std::cos(M_PI * j * (k + 0.5) / n);
+        c[j] = 2.0 * s / n;
+    }
+    return c;
+}
+
+struct BesselTables {
+    // A: 小参数段，B: 大参数段
+    std::vector<double> i0A, i0B, i1A, i1B, k0A, k0B, k1A, k1B;
+
+    BesselTables() {
+        using boost::math::cyl_bessel_i;
+        using boost::math::cyl_bessel_k;
+        // x = 4(t+1) ∈ [0,8]
+        i0A = chebFit([](double t) { double x = 4.0 * (t + 1.0); return cyl_bessel_i(0, x) * std::exp(-x); });
+        // e^{-x}I1 在 0 附近与 x 同阶，拟合 e^{-x}I1/x 以保持小参数下的相对精度
+        i1A = chebFit([](double t) { double x = 4.0 * (t + 1.0); return cyl_bessel_i(1, x) * std::exp(-x) / x; });
+        // w = (t+1)/2 = 8/x
+        i0B = chebFit([](double t) { return scaledSqrtI(0, 2.0 * kSplitI / (t + 1.0)); });
+        i1B = chebFit([](double t) { return scaledSqrtI(1, 2.0 * kSplitI / (t + 1.0)); });
+        // y = (t+1)/2 = x²/4
+        k0A = chebFit([](double t) {
+            double x = 2.0 * std::sqrt(0.5 * (t + 1.0));
+            return cyl_bessel_k(0, x) + std::log(0.5 * x) * cyl_bessel_i(0, x);
+        });
+        k1A = chebFit([](double t) {
+            double x = 2.0 * std::sqrt(0.5 * (t + 1.0));
+            return x * (cyl_bessel_k(1, x) - std::log(0.5 * x) * cyl_bessel_i(1, x));
+        });
+        // w = (t+1)/2 = 2/x
+        k0B = chebFit([](double t) { return scaledSqrtK(0, 2.0 * kSplitK / (t + 1.0)); });
+        k1B = chebFit([](double t) { return scaledSqrtK(1, 2.0 * kSplitK / (t + 1.0)); });
+    }
+};
+
+const BesselTables& tables()
+{
+    static const BesselTables t;
+    return t;
+}
+
+inline double clenshaw(double t, const std::vector<double>& c)
+{
+    double b1 = 0.0, b2 = 0.0, t2 = 2.0 * t;
+    for (int j = kChebLen - 1; j >= 1; --j) {
+        double b0 = t2 * b1 - b2 + c[j];
+        b2 = b1; b1 = b0;
+    }
+    return t * b1 - b2 + 0.5 * c[0];
+}
+
+#ifdef BESSELBATCH_HAS_AVX2
+
+bool cpuHasAvx2()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    static const bool has = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return has;
+#else
+    return true;
+#endif
+}
+
+// 向量化 e^x: x = k·ln2 + r, |r| <= ln2/2，e^r 用 13 阶 Taylor 多项式
+BESSELBATCH_TARGET inline __m256d expPd(__m256d x)
+{
+    const __m256d hi = _mm256_set1_pd(709.0), lo = _mm256_set1_pd(-708.0);
+    __m256d underflow = _mm256_cmp_pd(x, lo, _CMP_LT_OQ);
+    x = _mm256_max_pd(_mm256_min_pd(x, hi), lo);
+
+    __m256d k = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634)),
+                                _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_fnmadd_pd(k, _mm256_set1_pd(6.93147180369123816490e-01), x);
+    r = _mm256_fnmadd_pd(k, _mm256_set1_pd(1.90821492927058770002e-10), r);
+
+    static const double inv[] = { 1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0,
+                                  1.0 / 362880.0, 1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0,
+                                  1.0 / 24.0, 1.0 / 6.0, 0.5, 1.0, 1.0 };
+    __m256d p = _mm256_set1_pd(inv[0]);
+    for (int i = 1; i < 14; ++i) p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(inv[i]));
+
+    __m256i k64 = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k));
+    k64 = _mm256_slli_epi64(_mm256_add_epi64(k64, _mm256_set1_epi64x(1023)), 52);
+    __m256d res = _mm256_mul_pd(p, _mm256_castsi256_pd(k64));
+    return _mm256_andnot_pd(underflow, res);
+}
+
+// 向量化 ln(x), x > 0: x = 2^e·m, m ∈ [sqrt(2)/2, sqrt(2))，ln m = 2·atanh((m-1)/(m+1))
+BESSELBATCH_TARGET inline __m256d logPd(__m256d x)
+{
+    __m256i bits = _mm256_castpd_si256(x);
+    __m256i expBits = _mm256_srli_epi64(bits, 52);
+    const __m256d two52 = _mm256_set1_pd(4503599627370496.0);
+    __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(expBits, _mm256_castpd_si256(two52))), two52);
+    e = _mm256_sub_pd(e, _mm256_set1_pd(1023.0));
+
+    __m256i mantBits = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+                                       _mm256_set1_epi64x(0x3FF0000000000000LL));
+    __m256d m = _mm256_castsi256_pd(mantBits);
+    __m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(1.4142135623730951), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    e = _mm256_blendv_pd(e, _mm256_add_pd(e, _mm256_set1_pd(1.0)), big);
+
+    const __m256d one = _mm256_set1_pd(1.0);
+    __m256d s = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+    __m256d s2 = _mm256_mul_pd(s, s);
+    __m256d p = _mm256_set1_pd(1.0 / 21.0);
+    for (int k = 19; k >= 1; k -= 2) p = _mm256_fmadd_pd(p, s2, _mm256_set1_pd(1.0 / k));
+    __m256d lnm = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), s), p);
+
+    __m256d res = _mm256_fmadd_pd(e, _mm256_set1_pd(6.93147180369123816490e-01), lnm);
+    return _mm256_fmadd_pd(e, _mm256_set1_pd(1.90821492927058770002e-10), res);
+}
+
+// 两段系数按掩码混合的 Clenshaw 递推 (mask 为真取 a 段)
+BESSELBATCH_TARGET inline __m256d clenshawBlend(__m256d t, const double* a, const double* b, __m256d maskA)
+{
+    __m256d t2 = _mm256_add_pd(t, t);
+    __m256d b1 = _mm256_setzero_pd(), b2 = _mm256_setzero_pd();
+    for (int j = kChebLen - 1; j >= 1; --j) {
+        __m256d c = _mm256_blendv_pd(_mm256_set1_pd(b[j]), _mm256_set1_pd(a[j]), maskA);
+        __m256d b0 = _mm256_fmadd_pd(t2, b1, _mm256_sub_pd(c, b2));
+        b2 = b1; b1 = b0;
+    }
+    __m256d c0 = _mm256_blendv_pd(_mm256_set1_pd(b[0]), _mm256_set1_pd(a[0]), maskA);
+    return _mm256_fmadd_pd(t, b1, _mm256_fmadd_pd(_mm256_set1_pd(0.5), c0, _mm256_sub_pd(_mm256_setzero_pd(), b2)));
+}
+
+#endif // BESSELBATCH_HAS_AVX2
+
+} // namespace
+
+void BesselBatch::evaluate(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e)
+{
+    if (n <= 0) return;
+    if (isVectorized()) evaluateAvx2(x, n, k0, k1, i0e, i1e);
+    else evaluateScalar(x, n, k0, k1, i0e, i1e);
+}
+
+void BesselBatch::evaluate(double x, double& k0, double& k1, double& i0e, double& i1e)
+{
+    evaluateScalar(&x, 1, &k0, &k1, &i0e, &i1e);
+}
+
+bool BesselBatch::isVectorized()
+{
+#ifdef BESSELBATCH_HAS_AVX2
+    return cpuHasAvx2() && !g_forceScalar.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+void BesselBatch::setForceScalar(bool force)
+{
+    g_forceScalar.store(force);
+}
+
+void BesselBatch::evaluateScalar(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e)
+{
+    const BesselTables& T = tables();
+    for (int i = 0; i < n; ++i) {
+        double xi = std::max(x[i], 1e-300);
+        double vi0, vi1;
+        if (xi <= kSplitI) {
+            double t = 0.25 * xi - 1.0;
+            vi0 = clenshaw(t, T.i0A);
+            vi1 = clenshaw(t, T.i1A) * xi;
+        } else {
+            double t = 2.0 * kSplitI / xi - 1.0;
+            double r = 1.0 / std::sqrt(xi);
+            vi0 = clenshaw(t, T.i0B) * r;
+            vi1 = clenshaw(t, T.i1B) * r;
+        }
+        if (i0e) i0e[i] = vi0;
+        if (i1e) i1e[i] = vi1;
+
+        if (!k0 && !k1) continue;
+        double vk0, vk1;
+        if (xi <= kSplitK) {
+            double t = 0.5 * xi * xi - 1.0;
+            double ex = std::exp(xi);
+            double lg = std::log(0.5 * xi);
+            vk0 = -lg * vi0 * ex + clenshaw(t, T.k0A);
+            vk1 = lg * vi1 * ex + clenshaw(t, T.k1A) / xi;
+        } else {
+            double t = 2.0 * kSplitK / xi - 1.0;
+            double f = std::exp(-xi) / std::sqrt(xi);
+            vk0 = clenshaw(t, T.k0B) * f;
+            vk1 = clenshaw(t, T.k1B) * f;
+        }
+        if (k0) k0[i] = vk0;
+        if (k1) k1[i] = vk1;
+    }
+}
+
+#ifdef BESSELBATCH_HAS_AVX2
+BESSELBATCH_TARGET
+void BesselBatch::evaluateAvx2(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e)
+{
+    const BesselTables& T = tables();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d splitI = _mm256_set1_pd(kSplitI);
+    const __m256d splitK = _mm256_set1_pd(kSplitK);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d xv = _mm256_max_pd(_mm256_loadu_pd(x + i), _mm256_set1_pd(1e-300));
+        __m256d rsq = _mm256_div_pd(one, _mm256_sqrt_pd(xv));
+
+        // e^{-x}I0, e^{-x}I1
+        __m256d maskI = _mm256_cmp_pd(xv, splitI, _CMP_LE_OQ);
+        __m256d tI = _mm256_blendv_pd(_mm256_sub_pd(_mm256_div_pd(_mm256_add_pd(splitI, splitI), xv), one),
+                                      _mm256_fmsub_pd(_mm256_set1_pd(0.25), xv, one), maskI);
+        __m256d vi0 = _mm256_mul_pd(clenshawBlend(tI, T.i0A.data(), T.i0B.data(), maskI),
+                                    _mm256_blendv_pd(rsq, one, maskI));
+        __m256d vi1 = _mm256_mul_pd(clenshawBlend(tI, T.i1A.data(), T.i1B.data(), maskI),
+                                    _mm256_blendv_pd(rsq, xv, maskI));
+        if (i0e) _mm256_storeu_pd(i0e + i, vi0);
+        if (i1e) _mm256_storeu_pd(i1e + i, vi1);
+
+        if (!k0 && !k1) continue;
+
+        // K0, K1
+        __m256d maskK = _mm256_cmp_pd(xv, splitK, _CMP_LE_OQ);
+        __m256d tK = _mm256_blendv_pd(_mm256_sub_pd(_mm256_div_pd(_mm256_add_pd(splitK, splitK), xv), one),
+                                      _mm256_fmsub_pd(_mm256_mul_pd(half, xv), xv, one), maskK);
+        __m256d ck0 = clenshawBlend(tK, T.k0A.data(), T.k0B.data(), maskK);
+        __m256d ck1 = clenshawBlend(tK, T.k1A.data(), T.k1B.data(), maskK);
+
+        // 小参数段需要 e^{x} 还原 I，大参数段需要 e^{-x}
+        __m256d negx = _mm256_sub_pd(_mm256_setzero_pd(), xv);
+        __m256d ex = expPd(_mm256_blendv_pd(negx, xv, maskK));
+        __m256d lg = logPd(_mm256_mul_pd(half, xv));
+
+        __m256d smallK0 = _mm256_fnmadd_pd(_mm256_mul_pd(lg, vi0), ex, ck0);
+        __m256d smallK1 = _mm256_fmadd_pd(_mm256_mul_pd(lg, vi1), ex, _mm256_div_pd(ck1, xv));
+        __m256d f = _mm256_mul_pd(ex, rsq);
+        __m256d largeK0 = _mm256_mul_pd(ck0, f);
+        __m256d largeK1 = _mm256_mul_pd(ck1, f);
+
+        if (k0) _mm256_storeu_pd(k0 + i, _mm256_blendv_pd(largeK0, smallK0, maskK));
+        if (k1) _mm256_storeu_pd(k1 + i, _mm256_blendv_pd(largeK1, smallK1, maskK));
+    }
+
+    // 尾部不足 4 个的参数使用标量实现
+    if (i < n) {
+        evaluateScalar(x + i, n - i, k0 ? k0 + i : nullptr, k1 ? k1 + i : nullptr,
+                       i0e ? i0e + i : nullptr, i1e ? i1e + i : nullptr);
+    }
+}
+#else
+void BesselBatch::evaluateAvx2(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e)
+{
+    evaluateScalar(x, n, k0, k1, i0e, i1e);
+}
+#endif
@@ -0,0 +1,35 @@
+/*
+ * besselbatch.h
+ * 文件作用: 批量 Bessel 函数计算库头文件
+ * 功能描述:
+ * 1. 对参数数组批量计算 K0、K1、e^{-x}·I0、e^{-x}·I1。
+ * 2. 采用分段 Chebyshev 逼近 (系数在首次调用时由 boost 高精度值拟合得到)，
+ *    支持 AVX2 向量化 (运行时检测 CPU)，不支持时自动退回标量实现。
+ * 3. 纯数学工具，不依赖任何 UI 控件，所有函数均为静态且线程安全。
+ */
+
+#ifndef BESSELBATCH_H
+#define BESSELBATCH_H
+
+class BesselBatch
+{
+public:
+    // 批量计算，x 必须为正数；任一输出指针可为 nullptr 表示不需要该函数值
+    // k0/k1: K0(x), K1(x)；i0e/i1e: e^{-x} I0(x), e^{-x} I1(x)
+    static void evaluate(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e);
+
+    // 单点便捷接口
+    static void evaluate(double x, double& k0, double& k1, double& i0e, double& i1e);
+
+    // 当前是否使用 AVX2 向量化路径
+    static bool isVectorized();
+
+    // 强制使用标量实现 (用于与向量化结果对比)
+    static void setForceScalar(bool force);
+
+private:
+    static void evaluateScalar(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e);
+    static void evaluateAvx2(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e);
+};
+
+#endif // BESSELBATCH_H
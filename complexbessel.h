@@ -0,0 +1,47 @@
+/*
+ * complexbessel.h
+ * 文件作用: 复数参数 Bessel 函数及线源积分计算模块头文件
+ * 功能描述:
+ * 1. 提供复数参数 (Re(w) >= 0) 的 K0、K1 与缩放 I0、I1，供复平面拉普拉斯反演 (Talbot、de Hoog、Euler) 使用。
+ * 2. |w| <= 2 使用幂级数；较大参数 K 使用 Steed 连分式 (CF2) 或渐近展开，
+ *    I 与 ∫I0 使用 Miller 反向递推 (以 e^{w} = I0 + 2ΣIn 归一化)。
+ * 3. 提供与 LineSourceIntegral 对应的复数线段积分 ∫K0(γ|u|)du、∫I0(γ|u|)du。
+ */
+
+#ifndef COMPLEXBESSEL_H
+#define COMPLEXBESSEL_H
+
+#include <complex>
+
+class ComplexBessel
+{
+public:
+    using Complex = std::complex<double>;
+
+    // k0/k1: K0(w), K1(w)；i0e/i1e: e^{-w} I0(w), e^{-w} I1(w)
+    static void evaluate(Complex w, Complex& k0, Complex& k1, Complex& i0e, Complex& i1e);
+
+    // 缩放 K: e^{w} K0(w), e^{w} K1(w)
+    static void evaluateScaledK(Complex w, Complex& k0s, Complex& k1s);
+
+    // ∫_0^w K0(t) dt
+    static Complex integralK0(Complex w);
+
+    // Bickley-Naylor 函数 Ki1(w) = ∫_w^∞ K0(t) dt
+    static Complex bickleyKi1(Complex w);
+
+    // 缩放积分 e^{-w} * ∫_0^w I0(t) dt
+    static Complex integralI0Scaled(Complex w);
+
+    // 线段积分 ∫_{u1}^{u2} K0(γ|u|) du
+    static Complex segmentK0(Complex gamma, double u1, double u2);
+
+    // 线段积分 ∫_{u1}^{u2} I0(γ|u|) * e^{-shift} du
+    static Complex segmentI0Scaled(Complex gamma, double u1, double u2, Complex shift);
+
+private:
+    static Complex signedIntegralK0(Complex gamma, double u);
+    static Complex signedIntegralI0(Complex gamma, double u, Complex shift);
+};
+
+#endif // COMPLEXBESSEL_H
@@ -0,0 +1,200 @@
+/*
+ * fitbenchmark.cpp
+ * 文件作用: 拟合策略基准对比实现
+ * 功能描述:
+ * 1. 从项目文件或拟合分析页状态读取数据集。
+ * 2. 按 (数据集 × 配置) 依次执行拟合并计时，生成逐次结果与各配置汇总的文本报告。
+ */
+
+#include "fitbenchmark.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMap>
+#include "typecurvecache.h"
+#include "reservoirresponsecache.h"
+
+void FitBenchmark::addCase(const Case& c)
+{
+    m_cases.append(c);
+}
+
+bool FitBenchmark::caseFromFittingState(const QJsonObject& state, const QString& name, Case& out)
+{
+    Case c;
+    c.name = name;
+    c.type = (ModelSolver01_06::ModelType)state["modelType"].toInt();
+
+    // 权重: 新版保存滑块值 (0~100)，旧版保存 0~1 的小数
+    if (state.contains("fitWeightVal")) c.weight = state["fitWeightVal"].toInt() / 100.0;
+    else if (state.contains("fitWeight")) c.weight = state["fitWeight"].toDouble();
+
+    QJsonObject obs = state["observedData"].toObject();
+    for (auto v : obs["time"].toArray()) c.t.append(v.toDouble());
+    for (auto v : obs["pressure"].toArray()) c.deltaP.append(v.toDouble());
+    for (auto v : obs["derivative"].toArray()) c.derivative.append(v.toDouble());
+
+    bool anyFit = false;
+    QJsonArray arr = state["parameters"].toArray();
+    for (int i = 0; i < arr.size(); ++i) {
+        QJsonObject pObj = arr[i].toObject();
+        FitParameter p;
+        p.name = pObj["name"].toString();
+        p.displayName = p.name;
+        p.value = pObj["value"].toDouble();
+        p.isFit = pObj["isFit"].toBool();
+        p.min = pObj["min"].toDouble();
+        p.max = pObj["max"].toDouble();
+        p.isVisible = pObj.contains("isVisible") ? pObj["isVisible"].toBool() : true;
+        anyFit = anyFit || p.isFit;
+        c.params.append(p);
+    }
+
+    if (c.t.isEmpty() || c.deltaP.isEmpty() || !anyFit) return false;
+    // 含求解器不认识的拟合参数时引擎会拒绝拟合，不作为数据集
+    if (!FitEngine::unmappedParameters(c.params).isEmpty()) return false;
+    out = c;
+    return true;
+}
+
+int FitBenchmark::loadProject(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) return -1;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    file.close();
+    if (doc.isNull()) return -1;
+
+    QJsonObject root = doc.object();
+    QSharedPointer<const FractureGeometry> geometry;
+    FractureGeometry g = FractureGeometry::fromJson(root.value("fracture_geometry").toObject());
+    if (!g.isEmpty()) geometry = QSharedPointer<const FractureGeometry>(new FractureGeometry(g));
+
+    // 拟合页状态: 新版为 analyses 数组，旧版为单一状态
+    QJsonObject fitting = root.value("fitting").toObject();
+    QVector<QJsonObject> pages;
+    if (fitting.contains("analyses") && fitting["analyses"].isArray()) {
+        QJsonArray arr = fitting["analyses"].toArray();
+        for (int i = 0; i < arr.size(); ++i) pages.append(arr[i].toObject());
+    } else if (!fitting.isEmpty()) {
+        pages.append(fitting);
+    }
+
+    int added = 0;
+    for (int i = 0; i < pages.size(); ++i) {
+        QString page = pages[i].contains("_tabName") ? pages[i]["_tabName"].toString() : QString("Analysis %1").arg(i + 1);
+        Case c;
+        if (!caseFromFittingState(pages[i], filePath + ":" + page, c)) continue;
+        c.geometry = geometry;
+        // 被裂缝几何取代的参数勾选拟合时引擎同样会拒绝拟合
+        if (!FitEngine::geometryParameters(c.params, geometry).isEmpty()) continue;
+        m_cases.append(c);
+        ++added;
+    }
+    return added;
+}
+
+void FitBenchmark::addConfiguration(const Configuration& config)
+{
+    m_configs.append(config);
+}
+
+void FitBenchmark::addDefaultConfigurations()
+{
+    Configuration c;
+    c.label = "LM";
+    addConfiguration(c);
+    c.label = "LM+Broyden";
+    c.jacobianUpdate = FitEngine::JacobianUpdate::Broyden;
+    addConfiguration(c);
+    c.jacobianUpdate = FitEngine::JacobianUpdate::FiniteDifference;
+    c.label = "Nielsen";
+    c.strategy = FitEngine::Strategy::Nielsen;
+    addConfiguration(c);
+    c.label = "Geodesic";
+    c.strategy = FitEngine::Strategy::Geodesic;
+    addConfiguration(c);
+    c.label = "Dogleg";
+    c.strategy = FitEngine::Strategy::Dogleg;
+    addConfiguration(c);
+}
+
+QVector<FitBenchmark::Run> FitBenchmark::run() const
+{
+    QVector<Run> runs;
+    for (const Case& c : m_cases) {
+        for (const Configuration& config : m_configs) {
+            if (m_coldCache) {
+                TypeCurveCache::shared().clear();
+                ReservoirResponseCache::shared().clear();
+            }
+
+            FitEngine engine(c.type);
+            engine.setObservedData(c.t, c.deltaP, c.derivative);
+            engine.setParameters(c.params);
+            engine.setWeight(c.weight);
+            engine.setGeometry(c.geometry);
+            engine.setMaxIterations(m_maxIterations);
+            engine.setStrategy(config.strategy);
+            engine.setJacobianUpdate(config.jacobianUpdate);
+            engine.setStepSolver(config.stepSolver);
+
+            QElapsedTimer timer;
+            timer.start();
+            FitEngine::Result result = engine.run();
+
+            Run r;
+            r.wallMs = timer.nsecsElapsed() * 1e-6;
+            r.caseName = c.name;
+            r.label = config.label;
+            r.iterations = result.iterations;
+            r.modelSolves = result.modelSolves;
+            r.jacobianEvaluations = result.jacobianEvaluations;
+            r.error = result.error;
+            r.converged = result.converged;
+            runs.append(r);
+        }
+    }
+    return runs;
+}
+
+QString FitBenchmark::report(const QVector<Run>& runs)
+{
+    QString text = QString("%1 %2 %3 %4 %5 %6 %7 %8\n")
+        .arg("数据集", -24).arg("配置", -12).arg("迭代", 6).arg("求解", 7).arg("差分", 6)
+        .arg("误差", 11).arg("收敛", 5).arg("耗时(ms)", 11);
+    for (const Run& r : runs) {
+        text += QString("%1 %2 %3 %4 %5 %6 %7 %8\n")
+            .arg(r.caseName, -24).arg(r.label, -12).arg(r.iterations, 6).arg(r.modelSolves, 7)
+            .arg(r.jacobianEvaluations, 6).arg(r.error, 11, 'e', 3).arg(r.converged ? "是" : "否", 5)
+            .arg(r.wallMs, 11, 'f', 1);
+    }
+
+    // 各配置汇总 (按首次出现的顺序)
+    QVector<QString> labels;
+    QMap<QString, QVector<Run>> byLabel;
+    for (const Run& r : runs) {
+        if (!byLabel.contains(r.label)) labels.append(r.label);
+        byLabel[r.label].append(r);
+    }
+    text += QString("\n%1 %2 %3 %4 %5\n")
+        .arg("配置", -12).arg("收敛", 9).arg("平均迭代", 9).arg("平均求解", 9).arg("总耗时(ms)", 12);
+    for (const QString& label : labels) {
+        const QVector<Run>& list = byLabel[label];
+        int converged = 0;
+        double iterations = 0.0, solves = 0.0, ms = 0.0;
+        for (const Run& r : list) {
+            if (r.converged) ++converged;
+            iterations += r.iterations;
+            solves += r.modelSolves;
+            ms += r.wallMs;
+        }
+        text += QString("%1 %2 %3 %4 %5\n")
+            .arg(label, -12).arg(QString("%1/%2").arg(converged).arg(list.size()), 9)
+            .arg(iterations / list.size(), 9, 'f', 1).arg(solves / list.size(), 9, 'f', 1)
+            .arg(ms, 12, 'f', 1);
+    }
+    return text;
+}
@@ -0,0 +1,86 @@
+/*
+ * fitbenchmark.h
+ * 文件作用: 拟合策略基准对比头文件
+ * 功能描述:
+ * 1. FitBenchmark 回放保存的拟合数据集 (项目文件中各拟合分析页的观测数据、模型、参数表与权重)，
+ *    对每个数据集依次用各拟合配置 (迭代策略、雅可比更新方式、步长解法) 从相同的初始参数执行拟合。
+ * 2. 记录每次拟合的迭代次数、模型求解次数、雅可比差分次数、最终误差、是否收敛与墙钟耗时，并生成文本报告。
+ * 3. 默认在每次拟合前清空典型曲线与储层响应缓存，各配置从相同的冷缓存状态开始；
+ *    全部配置使用拟合档位的当前设置，耗时可以直接比较。
+ * 4. 命令行程序 tests/benchmarks/fitting (bench_fitting) 回放给定的项目文件并输出报告。
+ */
+
+#ifndef FITBENCHMARK_H
+#define FITBENCHMARK_H
+
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+#include <QVector>
+#include <QSharedPointer>
+#include "fitengine.h"
+
+class FitBenchmark
+{
+public:
+    // 一个数据集
+    struct Case {
+        QString name;
+        ModelSolver01_06::ModelType type = ModelSolver01_06::Model_1;
+        QVector<double> t;               // 观测时间
+        QVector<double> deltaP;          // 观测压差
+        QVector<double> derivative;      // 观测压差导数
+        QList<FitParameter> params;      // 初始参数表 (isFit 的参数参与拟合)
+        double weight = 0.5;             // 压差残差权重
+        QSharedPointer<const FractureGeometry> geometry; // 裂缝几何 (为空时等间距布置)
+    };
+
+    // 一组拟合配置
+    struct Configuration {
+        QString label;
+        FitEngine::Strategy strategy = FitEngine::Strategy::LevenbergMarquardt;
+        FitEngine::JacobianUpdate jacobianUpdate = FitEngine::JacobianUpdate::FiniteDifference;
+        FitEngine::StepSolver stepSolver = FitEngine::StepSolver::Cholesky;
+    };
+
+    // 一次拟合的结果
+    struct Run {
+        QString caseName;
+        QString label;                 // 配置名称
+        int iterations = 0;
+        int modelSolves = 0;
+        int jacobianEvaluations = 0;
+        double error = 0.0;            // 最终均方误差
+        bool converged = false;
+        double wallMs = 0.0;           // 拟合墙钟耗时 (含最终报告精度曲线)
+    };
+
+    void addCase(const Case& c);
+    int caseCount() const { return m_cases.size(); }
+    // 从拟合分析页保存的状态 (FittingWidget::getJsonState 的格式) 读取数据集，没有观测数据或拟合参数、或含无法映射到求解器的拟合参数时返回 false
+    static bool caseFromFittingState(const QJsonObject& state, const QString& name, Case& out);
+    // 读取项目文件 (.pwt) 中全部拟合分析页 (含裂缝几何)，返回读取的数据集个数，文件无法读取时返回 -1
+    int loadProject(const QString& filePath);
+
+    void addConfiguration(const Configuration& config);
+    int configurationCount() const { return m_configs.size(); }
+    // 全部迭代策略 (有限差分雅可比、LDLT 步长)，以及 LM + Broyden 修正
+    void addDefaultConfigurations();
+
+    void setMaxIterations(int maxIterations) { m_maxIterations = maxIterations; }
+    // 每次拟合前是否清空典型曲线与储层响应缓存 (默认清空)
+    void setColdCache(bool cold) { m_coldCache = cold; }
+
+    // 依次执行 (数据集 × 配置) 的全部拟合 (阻塞)
+    QVector<Run> run() const;
+    // 逐次拟合的文本表格，并附各配置的汇总 (收敛个数、平均迭代次数、平均模型求解次数与总耗时)
+    static QString report(const QVector<Run>& runs);
+
+private:
+    QVector<Case> m_cases;
+    QVector<Configuration> m_configs;
+    int m_maxIterations = 50;
+    bool m_coldCache = true;
+};
+
+#endif // FITBENCHMARK_H
@@ -0,0 +1,755 @@
+/*
+ * fitengine.cpp
+ * 文件作用: 试井曲线拟合引擎实现
+ * 功能描述:
+ * 1. Levenberg-Marquardt 迭代: 残差为观测与理论压差、导数的对数差 (按权重加权)，
+ *    雅可比矩阵由中心差分得到，对数敏感参数在对数空间更新并约束在参数上下限内。
+ * 2. 迭代使用拟合精度档位的当前设置 (由界面按需标定，见 AccuracyTuner)，并启用典型曲线、粗网格与储层响应缓存。
+ * 3. 雅可比矩阵的 2×拟合参数个数 次扰动求解在专用线程池中并行，每个任务使用独立的求解器实例，
+ *    并行时各扰动求解内部按时间点串行，总线程数不超过雅可比线程池的上限。
+ * 4. 线性代数使用一次分配的 Eigen 缓冲: J^T * J 由对称秩更新形成，步长方程可选 LDLT、列主元 QR 或 SVD 求解。
+ * 5. Broyden 模式: 接受步长后按残差变化对 J 做秩一修正，步长质量下降、步长被拒绝或达到刷新间隔时才重新差分。
+ * 6. 迭代策略: 固定倍数阻尼的 LM (默认)、Nielsen 阻尼更新、测地线加速 LM 与信赖域折线法，共用雅可比、步长求解与参数约束。
+ */
+
+#include "fitengine.h"
+
+#include <QDebug>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+// 一次拟合的线性代数缓冲: 按残差数与拟合参数个数一次分配，迭代与阻尼尝试中只覆盖内容
+struct FitEngine::Workspace {
+    Eigen::MatrixXd J;              // 雅可比矩阵 (nRes × nParams，按列连续存放)
+    Eigen::MatrixXd perturbed;      // 扰动残差 (nRes × 2nParams，第 2j、2j+1 列为 ±h 扰动)
+    Eigen::MatrixXd H;              // J^T * J (只使用下三角)
+    Eigen::MatrixXd Hlm;            // 加阻尼后的 H (Cholesky 步长)
+    Eigen::MatrixXd augmented;      // 增广矩阵 [J; sqrt(lambda * D)] (QR/SVD 步长)
+    Eigen::VectorXd residuals;      // 当前残差
+    Eigen::VectorXd trialResiduals; // 试探步残差
+    Eigen::VectorXd g;              // J^T * r
+    Eigen::VectorXd negG;           // -g
+    Eigen::VectorXd damping;        // 阻尼对角阵 D = 1 + |H_ii|
+    Eigen::VectorXd delta;          // 步长
+    Eigen::VectorXd step;           // 约束后实际接受的步长 (与 J 的列同一坐标: 对数参数为 log10 增量)
+    Eigen::VectorXd linearized;     // 线性模型预测的残差 r + J * step
+    // 测地线加速
+    Eigen::VectorXd velocity;       // 速度 (LM 步长)
+    Eigen::VectorXd accel;          // 加速度
+    Eigen::VectorXd probeDelta;     // 探测步长 h * v
+    Eigen::VectorXd probeStep;      // 约束后的实际探测步长
+    Eigen::VectorXd probeResiduals; // 探测点残差
+    Eigen::VectorXd rvv;            // 残差沿速度方向的二阶方向导数
+    Eigen::VectorXd gAccel;         // J^T * r_vv
+    Eigen::VectorXd rhsAccel;       // 增广右端项 [-r_vv; 0]
+    // 信赖域折线法
+    Eigen::VectorXd gaussNewton;    // Gauss-Newton 步
+    Eigen::VectorXd cauchy;         // Cauchy 步 (沿负梯度的模型极小点)
+    Eigen::VectorXd dogleg;         // Gauss-Newton 步 - Cauchy 步
+    Eigen::VectorXd Hg;             // H * g
+    Eigen::VectorXd rhs;            // 增广右端项 [-r; 0]
+    Eigen::LDLT<Eigen::MatrixXd> ldlt;
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr;
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd;
+
+    void resize(int nRes, int nParams, StepSolver solver)
+    {
+        J.resize(nRes, nParams);
+        perturbed.resize(nRes, 2 * nParams);
+        H.resize(nParams, nParams);
+        Hlm.resize(nParams, nParams);
+        residuals.setZero(nRes);
+        trialResiduals.setZero(nRes);
+        g.resize(nParams);
+        negG.resize(nParams);
+        damping.resize(nParams);
+        delta.setZero(nParams);
+        step.setZero(nParams);
+        linearized.resize(nRes);
+        velocity.resize(nParams);
+        accel.setZero(nParams);
+        probeDelta.resize(nParams);
+        probeStep.resize(nParams);
+        probeResiduals.resize(nRes);
+        rvv.resize(nRes);
+        gAccel.resize(nParams);
+        gaussNewton.resize(nParams);
+        cauchy.resize(nParams);
+        dogleg.resize(nParams);
+        Hg.resize(nParams);
+        switch (solver) {
+        case StepSolver::QR:
+            augmented.resize(nRes + nParams, nParams);
+            rhs.resize(nRes + nParams);
+            rhsAccel.resize(nRes + nParams);
+            qr = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>(nRes + nParams, nParams);
+            break;
+        case StepSolver::SVD:
+            augmented.resize(nRes + nParams, nParams);
+            rhs.resize(nRes + nParams);
+            rhsAccel.resize(nRes + nParams);
+            svd = Eigen::JacobiSVD<Eigen::MatrixXd>(nRes + nParams, nParams, Eigen::ComputeThinU | Eigen::ComputeThinV);
+            break;
+        case StepSolver::Cholesky:
+        default:
+            ldlt = Eigen::LDLT<Eigen::MatrixXd>(nParams);
+            break;
+        }
+    }
+};
+
+FitEngine::FitEngine(ModelSolver01_06::ModelType type)
+    : m_type(type)
+    , m_solver(type)
+    , m_stopRequested(false)
+{
+}
+
+void FitEngine::setObservedData(const QVector<double>& t, const QVector<double>& deltaP, const QVector<double>& derivative)
+{
+    m_obsTime = t;
+    m_obsDeltaP = deltaP;
+    m_obsDerivative = derivative;
+}
+
+void FitEngine::setParameters(const QList<FitParameter>& params)
+{
+    m_params = params;
+}
+
+void FitEngine::setWeight(double weight)
+{
+    m_weight = weight;
+}
+
+void FitEngine::setGeometry(const QSharedPointer<const FractureGeometry>& geometry)
+{
+    m_geometry = geometry;
+}
+
+void FitEngine::setSolverStats(SolverStats* stats)
+{
+    m_stats = stats;
+}
+
+void FitEngine::setMaxIterations(int maxIterations)
+{
+    m_maxIterations = maxIterations;
+}
+
+void FitEngine::setStepSolver(StepSolver solver)
+{
+    m_stepSolver = solver;
+}
+
+void FitEngine::setStrategy(Strategy strategy)
+{
+    m_strategy = strategy;
+}
+
+void FitEngine::setJacobianUpdate(JacobianUpdate update, int refreshInterval)
+{
+    m_jacobianUpdate = update;
+    m_jacobianRefreshInterval = qMax(1, refreshInterval);
+}
+
+void FitEngine::setIterationCallback(const IterationCallback& callback)
+{
+    m_onIteration = callback;
+}
+
+void FitEngine::setProgressCallback(const ProgressCallback& callback)
+{
+    m_onProgress = callback;
+}
+
+void FitEngine::requestStop()
+{
+    m_stopRequested.store(true);
+}
+
+bool FitEngine::stopRequested() const
+{
+    return m_stopRequested.load();
+}
+
+// 雅可比扰动求解专用线程池
+QThreadPool* FitEngine::jacobianThreadPool()
+{
+    static QThreadPool pool;
+    return &pool;
+}
+
+void FitEngine::setMaxThreadCount(int count)
+{
+    jacobianThreadPool()->setMaxThreadCount(count > 0 ? count : QThread::idealThreadCount());
+}
+
+int FitEngine::maxThreadCount()
+{
+    return jacobianThreadPool()->maxThreadCount();
+}
+
+QStringList FitEngine::unmappedParameters(const QList<FitParameter>& params)
+{
+    QStringList names;
+    for (const FitParameter& p : params) {
+        if (p.isFit && ModelParams::slotOf(p.name) < 0) names.append(p.name);
+    }
+    return names;
+}
+
+QStringList FitEngine::geometryParameters(const QList<FitParameter>& params, const QSharedPointer<const FractureGeometry>& geometry)
+{
+    QStringList names;
+    if (!geometry || geometry->isEmpty()) return names;
+    for (const FitParameter& p : params) {
+        if (p.isFit && (p.name == "nf" || p.name == "Lf" || p.name == "LfD")) names.append(p.name);
+    }
+    return names;
+}
+
+bool FitEngine::isLogParameter(const QString& name, double value)
+{
+    return value > 1e-12 && name != "S" && name != "nf";
+}
+
+// 拟合迭代 (Levenberg-Marquardt 及其变体)
+FitEngine::Result FitEngine::run()
+{
+    Result result;
+
+    // 拟合迭代使用拟合精度档位以提高速度 (按调用传入，不影响界面或其他拟合的计算)
+    AccuracySettings accuracy = AccuracyProfiles::settings(AccuracyProfile::Fit);
+    SolverOptions fitOptions = accuracy.apply();
+    fitOptions.stats = m_stats;
+    // 观测点很多时 (如高频采样的压力计数据) 在自适应粗网格上求解后插值到观测时间
+    fitOptions.coarseGridTolerance = 1e-4;
+    // 井储、表皮与压敏系数的迭代和雅可比列复用缓存的储层响应，只重算井储施加与反演
+    fitOptions.reservoirCache = true;
+
+    // 勾选拟合的参数必须都能映射到求解器参数槽位，否则拒绝拟合 (不能悄悄当作定值)
+    // 设置了裂缝几何时求解器按几何计算，nf 与裂缝半长不起作用 (雅可比列恒为零)，同样拒绝拟合
+    result.unmappedParameters = unmappedParameters(m_params);
+    result.geometryParameters = geometryParameters(m_params, m_geometry);
+    if (!result.unmappedParameters.isEmpty() || !result.geometryParameters.isEmpty()) {
+        if (!result.unmappedParameters.isEmpty())
+            qWarning() << "FitEngine: 以下拟合参数没有对应的求解器参数，拒绝拟合:" << result.unmappedParameters;
+        if (!result.geometryParameters.isEmpty())
+            qWarning() << "FitEngine: 已设置裂缝几何，以下拟合参数不起作用，拒绝拟合:" << result.geometryParameters;
+        for(const auto& p : m_params) result.params.insert(p.name, p.value);
+        m_stopRequested.store(false);
+        return result;
+    }
+
+    // 找出需要拟合的参数索引及其在参数块中的槽位
+    QVector<int> fitIndices;
+    QVector<int> fitSlots;
+    for(int i=0; i<m_params.size(); ++i) {
+        if(m_params[i].isFit) {
+            fitIndices.append(i);
+            fitSlots.append(ModelParams::slotOf(m_params[i].name));
+        }
+    }
+    int nParams = fitIndices.size();
+    result.fittedCount = nParams;
+
+    // 构建参数映射 (用于回调与结果)
+    QMap<QString, double> currentParamMap;
+    for(const auto& p : m_params) currentParamMap.insert(p.name, p.value);
+
+    // 处理复合参数（如裂缝穿透比 LfD）
+    if(currentParamMap.contains("L") && currentParamMap.contains("Lf") && currentParamMap["L"] > 1e-9)
+        currentParamMap["LfD"] = currentParamMap["Lf"] / currentParamMap["L"];
+    result.params = currentParamMap;
+
+    // 如果没有选定拟合参数，直接返回
+    if(nParams == 0) {
+        m_stopRequested.store(false);
+        return result;
+    }
+
+    // LM 算法参数初始化
+    double lambda = 0.01;
+    double currentSSE = 1e15;
+
+    // 一次性转换为求解器参数块，迭代过程中只按槽位修改
+    ModelParams currentParams = ModelParams::fromMap(currentParamMap);
+    currentParams.geometry = m_geometry;
+
+    // 典型曲线缓存: 只平移 tD、缩放压力的参数 (孔隙度、产量等) 的迭代与雅可比列直接由缓存的无因次曲线插值得到。
+    // 有改变无因次曲线的参数参与拟合时，每次迭代与这些参数的雅可比列都会换一条曲线，每次未命中都要求解整条对数网格，
+    // 只有观测点数多于网格点数时才比直接求解观测点便宜，否则不开启 (也避免无用的曲线挤出缓存)
+    bool sharedTypeCurve = true;
+    for(int i=0; i<nParams; ++i) {
+        ModelParams perturbed = currentParams;
+        perturbed.v[fitSlots[i]] = perturbed.v[fitSlots[i]] * 1.5 + 1.0;
+        sharedTypeCurve = sharedTypeCurve && ModelSolver01_06::sharesTypeCurve(m_type, currentParams, perturbed, fitOptions);
+    }
+    fitOptions.typeCurveCache = sharedTypeCurve
+        || m_obsTime.size() > ModelSolver01_06::typeCurveGridPoints(currentParams, m_obsTime, fitOptions);
+
+    result.accuracy = accuracy;
+
+    // 将参数块中的拟合结果同步回参数映射
+    auto syncParamMap = [&]() {
+        for(int i=0; i<nParams; ++i) currentParamMap[m_params[fitIndices[i]].name] = currentParams.v[fitSlots[i]];
+        if(currentParamMap.contains("LfD")) currentParamMap["LfD"] = currentParams[ModelParams::LfD];
+    };
+
+    // 通知当前状态 (显示曲线只在设置了回调时计算)
+    auto notify = [&](int iteration, int nRes) {
+        if (!m_onIteration) return;
+        Iteration state;
+        state.iteration = iteration;
+        state.error = currentSSE / nRes;
+        state.params = currentParamMap;
+        state.curve = m_solver.calculateTheoreticalCurve(currentParams, QVector<double>(), fitOptions);
+        m_onIteration(state);
+    };
+
+    // 线性代数缓冲按残差数与拟合参数个数一次分配，迭代与阻尼尝试中复用
+    Workspace ws;
+    ws.resize(residualCount(), nParams, m_stepSolver);
+    int nRes = (int)ws.residuals.size();
+
+    // 计算初始残差 (理论曲线计算失败时误差记为无穷大，不迭代，结果不会报告为收敛)
+    bool initialValid = calculateResiduals(m_solver, currentParams, fitOptions, ws.residuals);
+    ++result.modelSolves;
+    currentSSE = initialValid ? ws.residuals.squaredNorm() : std::numeric_limits<double>::infinity();
+    if (!initialValid) qWarning() << "FitEngine: 初始参数的理论曲线计算失败，不执行拟合";
+    notify(0, nRes);
+
+    // Broyden 模式下 J 是否需要重新差分，及距上次差分的迭代次数
+    bool broyden = (m_jacobianUpdate == JacobianUpdate::Broyden);
+    bool refreshJacobian = true;
+    int sinceRefresh = 0;
+
+    // Nielsen 阻尼的拒绝倍数与折线法的信赖域半径 (与 J 的列同一坐标)
+    double nu = 2.0;
+    double radius = kDoglegInitialRadius;
+
+    // 试探步: 按 delta 更新参数并计算残差，同时给出步长质量 (实际下降量 / 线性模型预测下降量)；返回误差是否减小。
+    // 理论曲线计算失败 (残差被置零) 时按拒绝处理，步长质量记为 0 (与计算雅可比时丢弃失败的扰动求解一致)
+    ModelParams trialParams;
+    double trialSSE = 0.0;
+    double trialQuality = 0.0;
+    auto evaluateTrial = [&](const Eigen::VectorXd& delta) {
+        applyStep(currentParams, delta, fitIndices, fitSlots, trialParams, ws.step);
+        bool evaluated = calculateResiduals(m_solver, trialParams, fitOptions, ws.trialResiduals);
+        ++result.modelSolves;
+        if (!evaluated) {
+            trialSSE = std::numeric_limits<double>::infinity();
+            trialQuality = 0.0;
+            return false;
+        }
+        trialSSE = ws.trialResiduals.squaredNorm();
+        ws.linearized = ws.residuals;
+        ws.linearized.noalias() += ws.J * ws.step;
+        double predicted = currentSSE - ws.linearized.squaredNorm();
+        double actual = currentSSE - trialSSE;
+        trialQuality = (predicted > 0.0) ? actual / predicted : (actual > 0.0 ? 1.0 : 0.0);
+        return trialSSE < currentSSE;
+    };
+    // 接受最近一次试探步
+    auto acceptTrial = [&](int iter) {
+        if (broyden) refreshJacobian = !broydenUpdate(ws, trialQuality);
+        currentSSE = trialSSE;
+        currentParams = trialParams;
+        syncParamMap();
+        ws.residuals.swap(ws.trialResiduals);
+        notify(iter + 1, nRes);
+    };
+
+    // 迭代循环
+    for(int iter = 0; initialValid && iter < m_maxIterations; ++iter) {
+        if(m_stopRequested.load()) { result.stopped = true; break; }
+        // 收敛条件判断
+        if (nRes > 0 && (currentSSE / nRes) < kConvergedError) break;
+
+        if (m_onProgress) m_onProgress(iter * 100 / m_maxIterations);
+        result.iterations = iter + 1;
+
+        // 计算雅可比矩阵 J (Broyden 模式下沿用上次接受步长后修正的 J，需要时才重新差分)
+        if (!broyden || refreshJacobian || sinceRefresh >= m_jacobianRefreshInterval) {
+            computeJacobian(currentParams, fitIndices, fitSlots, fitOptions, ws);
+            ++result.jacobianEvaluations;
+            result.modelSolves += 2 * nParams;
+            refreshJacobian = false;
+            sinceRefresh = 0;
+        }
+        bool jacobianFresh = (sinceRefresh == 0);
+        ++sinceRefresh;
+
+        // 计算 H = J^T * J (对称秩更新，只写下三角) 和 g = J^T * r
+        ws.H.setZero();
+        ws.H.selfadjointView<Eigen::Lower>().rankUpdate(ws.J.transpose());
+        ws.g.noalias() = ws.J.transpose() * ws.residuals;
+        ws.damping = (ws.H.diagonal().array().abs() + 1.0).matrix();
+        ws.negG = -ws.g;
+        if (m_stepSolver != StepSolver::Cholesky) {
+            // 增广最小二乘的上半部分在各次阻尼尝试间不变
+            ws.augmented.topRows(nRes) = ws.J;
+            ws.rhs.head(nRes) = -ws.residuals;
+            ws.rhs.tail(nParams).setZero();
+        }
+
+        bool stepAccepted = false;
+        bool exhausted = false; // 阻尼或信赖域已到极限，当前 J 下无法继续下降
+        switch (m_strategy) {
+        case Strategy::Nielsen:
+            // 接受时按步长质量连续缩小 lambda (最多缩小到 1/3)，拒绝时按 2、4、8… 倍增大
+            for (int tryIter = 0; tryIter < kMaxTrials && !stepAccepted; ++tryIter) {
+                if (solveStep(ws, lambda) && evaluateTrial(ws.delta)) {
+                    double t = 2.0 * trialQuality - 1.0;
+                    lambda *= qMax(1.0 / 3.0, 1.0 - t * t * t);
+                    nu = 2.0;
+                    acceptTrial(iter);
+                    stepAccepted = true;
+                } else {
+                    lambda *= nu;
+                    nu *= 2.0;
+                }
+            }
+            exhausted = lambda > 1e10;
+            break;
+
+        case Strategy::Geodesic:
+            // 速度 v 为 LM 步长；沿 v 的二阶方向导数 r_vv 由一次探测求解差分得到，加速度 a 满足
+            // (H + lambda * D) a = -J^T r_vv，步长取 v + a / 2。|2a| / |v| 超过 kGeodesicMaxRatio 时不计算试探步，直接拒绝；
+            // 阻尼按 Nielsen 规则更新 (低精度档位的模型误差使二阶差分带噪声，固定倍数的阻尼调整容易在窄谷中反复拒绝)
+            for (int tryIter = 0; tryIter < kMaxTrials && !stepAccepted; ++tryIter) {
+                bool ok = solveStep(ws, lambda);
+                if (ok) {
+                    ws.velocity = ws.delta;
+                    // 探测步长取 h v，且不短于 kGeodesicMinProbe (速度很小时差分会被模型求解误差主导)
+                    double sigma = qMax(kGeodesicProbeStep, kGeodesicMinProbe / qMax(ws.velocity.norm(), 1e-300));
+                    ws.probeDelta = sigma * ws.velocity;
+                    applyStep(currentParams, ws.probeDelta, fitIndices, fitSlots, trialParams, ws.probeStep);
+                    ok = calculateResiduals(m_solver, trialParams, fitOptions, ws.probeResiduals);
+                    ++result.modelSolves;
+                    // 探测求解失败时没有 r_vv，与试探步失败一样拒绝并增大阻尼
+                    if (ok) {
+                        // r_vv = 2 / h^2 * (r(x + s) - r(x) - J s)，s 为约束后的实际探测步长 (约为 h v)
+                        ws.rvv = ws.probeResiduals - ws.residuals;
+                        ws.rvv.noalias() -= ws.J * ws.probeStep;
+                        ws.rvv *= 2.0 / (sigma * sigma);
+                        ok = solveAcceleration(ws) && 2.0 * ws.accel.norm() <= kGeodesicMaxRatio * ws.velocity.norm();
+                    }
+                }
+                if (ok) {
+                    ws.delta = ws.velocity + 0.5 * ws.accel;
+                    ok = evaluateTrial(ws.delta);
+                }
+                if (ok) {
+                    double t = 2.0 * trialQuality - 1.0;
+                    lambda *= qMax(1.0 / 3.0, 1.0 - t * t * t);
+                    nu = 2.0;
+                    acceptTrial(iter);
+                    stepAccepted = true;
+                } else {
+                    lambda *= nu;
+                    nu *= 2.0;
+                }
+            }
+            exhausted = lambda > 1e10;
+            break;
+
+        case Strategy::Dogleg: {
+            // Gauss-Newton 步与最速下降 (Cauchy) 步按信赖域半径组合，半径按步长质量放大或缩小
+            double gNorm = ws.g.norm();
+            if (!(gNorm > 0.0)) { exhausted = true; break; }
+            bool gnValid = solveStep(ws, kDoglegGaussNewtonDamping);
+            ws.gaussNewton = ws.delta;
+            double gnNorm = ws.gaussNewton.norm();
+            ws.Hg.noalias() = ws.H.selfadjointView<Eigen::Lower>() * ws.g;
+            double gHg = ws.g.dot(ws.Hg);
+            ws.cauchy = (gHg > 0.0 ? -gNorm * gNorm / gHg : -radius / gNorm) * ws.g;
+            double cauchyNorm = ws.cauchy.norm();
+
+            for (int tryIter = 0; tryIter < kMaxTrials && !stepAccepted; ++tryIter) {
+                if (gnValid && gnNorm <= radius) {
+                    ws.delta = ws.gaussNewton;
+                } else if (cauchyNorm >= radius) {
+                    ws.delta = (-radius / gNorm) * ws.g;
+                } else if (!gnValid) {
+                    ws.delta = ws.cauchy;
+                } else {
+                    // Cauchy 点到 Gauss-Newton 点的连线与信赖域边界的交点
+                    ws.dogleg = ws.gaussNewton - ws.cauchy;
+                    double a = ws.dogleg.squaredNorm();
+                    double b = 2.0 * ws.cauchy.dot(ws.dogleg);
+                    double c = cauchyNorm * cauchyNorm - radius * radius;
+                    double beta = (-b + std::sqrt(b * b - 4.0 * a * c)) / (2.0 * a);
+                    ws.delta = ws.cauchy + beta * ws.dogleg;
+                }
+                double stepNorm = ws.delta.norm();
+                bool decreased = evaluateTrial(ws.delta);
+                if (trialQuality < 0.25) radius = 0.25 * stepNorm;
+                else if (trialQuality > 0.75 && stepNorm >= 0.99 * radius) radius = qMin(2.0 * radius, kDoglegMaxRadius);
+
+                if (decreased) {
+                    acceptTrial(iter);
+                    stepAccepted = true;
+                } else if (radius < kDoglegMinRadius) {
+                    break;
+                }
+            }
+            exhausted = radius < kDoglegMinRadius;
+            break;
+        }
+
+        case Strategy::LevenbergMarquardt:
+        default:
+            // 接受时 lambda / 10，拒绝时 lambda * 10，每次迭代最多 5 次尝试
+            for(int tryIter=0; tryIter<5; ++tryIter) {
+                // 求解 (H + lambda * D) * delta = -g
+                if (!solveStep(ws, lambda)) {
+                    lambda *= 10.0;
+                    continue;
+                }
+                if (evaluateTrial(ws.delta)) {
+                    acceptTrial(iter);
+                    lambda /= 10.0;
+                    stepAccepted = true;
+                    break;
+                }
+                // 否则增大 lambda 增加阻尼
+                lambda *= 10.0;
+            }
+            exhausted = lambda > 1e10;
+            break;
+        }
+
+        if(!stepAccepted) {
+            // 修正得到的 J 可能已偏离真实导数，先重新差分再判断是否停止
+            if (broyden && !jacobianFresh) { refreshJacobian = true; continue; }
+            if (exhausted) break;
+        }
+    }
+
+    // 最终以报告精度计算一次理论曲线
+    if(currentParamMap.contains("L") && currentParamMap.contains("Lf") && currentParamMap["L"] > 1e-9)
+        currentParamMap["LfD"] = currentParamMap["Lf"] / currentParamMap["L"];
+
+    ModelParams finalParams = ModelParams::fromMap(currentParamMap);
+    finalParams.geometry = m_geometry;
+    SolverOptions reportOptions = AccuracyProfiles::options(AccuracyProfile::Report);
+    reportOptions.stats = m_stats;
+    result.curve = m_solver.calculateTheoreticalCurve(finalParams, QVector<double>(), reportOptions);
+
+    result.params = currentParamMap;
+    result.sse = currentSSE;
+    result.error = (nRes == 0) ? 0.0 : currentSSE / nRes;
+    result.converged = nRes > 0 && result.error < kConvergedError;
+    m_stopRequested.store(false);
+    return result;
+}
+
+// 残差个数: 压差残差取观测压差与时间点数的较小者，导数残差不超过压差残差个数
+int FitEngine::residualCount() const
+{
+    int count = qMin(m_obsDeltaP.size(), m_obsTime.size());
+    int dCount = qMin(m_obsDerivative.size(), count);
+    return count + dCount;
+}
+
+// 计算残差向量 (写入 out，长度为 residualCount())
+bool FitEngine::calculateResiduals(const ModelSolver01_06& solver, const ModelParams& params, const SolverOptions& options,
+                                   Eigen::Ref<Eigen::VectorXd> out) const
+{
+    if(m_obsTime.isEmpty()) return false;
+
+    ModelCurveData res = solver.calculateTheoreticalCurve(params, m_obsTime, options);
+    const QVector<double>& pCal = std::get<1>(res);
+    const QVector<double>& dpCal = std::get<2>(res);
+
+    double wp = m_weight;
+    double wd = 1.0 - m_weight;
+
+    int count = qMin(m_obsDeltaP.size(), m_obsTime.size());
+    int dCount = qMin(m_obsDerivative.size(), count);
+    if (pCal.size() < count || dpCal.size() < dCount) {
+        out.setZero();
+        return false;
+    }
+
+    // 计算压差残差 (对数差值)
+    for(int i=0; i<count; ++i) {
+        if(m_obsDeltaP[i] > 1e-10 && pCal[i] > 1e-10)
+            out(i) = (log(m_obsDeltaP[i]) - log(pCal[i])) * wp;
+        else
+            out(i) = 0.0;
+    }
+
+    // 计算导数残差 (对数差值)
+    for(int i=0; i<dCount; ++i) {
+        if(m_obsDerivative[i] > 1e-10 && dpCal[i] > 1e-10)
+            out(count + i) = (log(m_obsDerivative[i]) - log(dpCal[i])) * wd;
+        else
+            out(count + i) = 0.0;
+    }
+    return true;
+}
+
+// 计算雅可比矩阵（中心差分法）: 先生成全部扰动参数组，2×nParams 次求解相互独立，分发到雅可比线程池并行计算；
+// 扰动残差按参数组下标写入缓冲的对应列，再按列串行组装，结果与线程数和任务完成顺序无关
+void FitEngine::computeJacobian(const ModelParams& params, const QVector<int>& fitIndices, const QVector<int>& fitSlots,
+                                const SolverOptions& options, Workspace& ws) const
+{
+    int nParams = fitIndices.size();
+
+    // 第 2j 组为 +h 扰动，第 2j+1 组为 -h 扰动
+    QVector<ModelParams> perturbed(2 * nParams, params);
+    QVector<double> steps(nParams);
+    for(int j = 0; j < nParams; ++j) {
+        int slot = fitSlots[j];
+        const QString& pName = m_params[fitIndices[j]].name;
+        double val = params.v[slot];
+        ModelParams& pPlus = perturbed[2 * j];
+        ModelParams& pMinus = perturbed[2 * j + 1];
+
+        // 确定扰动步长 h
+        double h;
+        if(isLogParameter(pName, val)) {
+            h = 0.01;
+            double valLog = log10(val);
+            pPlus.v[slot] = pow(10.0, valLog + h);
+            pMinus.v[slot] = pow(10.0, valLog - h);
+        } else {
+            h = 1e-4;
+            pPlus.v[slot] = val + h;
+            pMinus.v[slot] = val - h;
+        }
+        steps[j] = h;
+
+        // 联动更新依赖参数
+        if(slot == ModelParams::L || slot == ModelParams::Lf) { pPlus.updateDependents(); pMinus.updateDependents(); }
+    }
+
+    // 求解器实例不含可变状态，每个任务构造一个，任务之间不共享对象；缓存与统计记录本身是线程安全的。
+    // 扰动求解并行时内部按时间点串行 (否则两层线程池叠加，线程数约为核心数的平方)；串行时内部仍使用求解器线程池
+    QVector<char> solved(perturbed.size(), 0);
+    auto solveJob = [&](int k) {
+        ModelSolver01_06 solver(m_type);
+        solved[k] = calculateResiduals(solver, perturbed[k], options, ws.perturbed.col(k)) ? 1 : 0;
+    };
+    QThreadPool* pool = jacobianThreadPool();
+    if (perturbed.size() > 1 && pool->maxThreadCount() > 1) {
+        QVector<int> jobs(perturbed.size());
+        std::iota(jobs.begin(), jobs.end(), 0);
+        QtConcurrent::blockingMap(pool, jobs, [&](int k) {
+            ModelSolver01_06::SerialScope serial;
+            solveJob(k);
+        });
+    } else {
+        for (int k = 0; k < perturbed.size(); ++k) solveJob(k);
+    }
+
+    for(int j = 0; j < nParams; ++j) {
+        // 中心差分公式
+        if(solved[2 * j] && solved[2 * j + 1])
+            ws.J.col(j) = (ws.perturbed.col(2 * j) - ws.perturbed.col(2 * j + 1)) / (2.0 * steps[j]);
+        else
+            ws.J.col(j).setZero();
+    }
+}
+
+// 按步长 delta 更新拟合参数 (对数敏感参数在对数空间更新) 并约束在参数上下限内，
+// step 写入约束后的实际步长 (对数参数为 log10 增量，与 J 的列同一坐标)
+void FitEngine::applyStep(const ModelParams& current, const Eigen::VectorXd& delta, const QVector<int>& fitIndices,
+                          const QVector<int>& fitSlots, ModelParams& trial, Eigen::VectorXd& step) const
+{
+    trial = current;
+    for(int i=0; i<fitIndices.size(); ++i) {
+        const FitParameter& fp = m_params[fitIndices[i]];
+        double oldVal = current.v[fitSlots[i]];
+        bool logParam = isLogParameter(fp.name, oldVal);
+        double newVal = logParam ? pow(10.0, log10(oldVal) + delta(i)) : oldVal + delta(i);
+
+        // 约束参数范围
+        newVal = qMax(fp.min, qMin(newVal, fp.max));
+        trial.v[fitSlots[i]] = newVal;
+        step(i) = (logParam && newVal > 0.0) ? log10(newVal) - log10(oldVal) : newVal - oldVal;
+    }
+
+    // 更新依赖参数
+    trial.updateDependents();
+}
+
+// Broyden 秩一修正: J += (r_new - r_old - J * dx) * dx^T / (dx^T * dx)，dx 为约束后实际接受的步长，
+// r_old + J * dx 为试探步计算时保存的线性模型预测。步长质量低于 kBroydenMinStepQuality
+// 或步长过小无法修正时返回 false，调用方在下次迭代重新差分
+bool FitEngine::broydenUpdate(Workspace& ws, double quality) const
+{
+    double stepNorm2 = ws.step.squaredNorm();
+    if (!(stepNorm2 > 1e-30)) return false;
+
+    ws.J.noalias() += ((ws.trialResiduals - ws.linearized) / stepNorm2) * ws.step.transpose();
+    return quality >= kBroydenMinStepQuality;
+}
+
+// 求解步长方程 (H + lambda * D) * delta = -g，D 为 1 + |H_ii| 构成的对角阵。
+// Cholesky: 对加阻尼的正规方程做 LDLT 分解；QR/SVD: 对等价的增广最小二乘 [J; sqrt(lambda * D)] delta = [-r; 0] 求解，
+// 不形成 J^T * J，条件数不平方。分解对象与矩阵均为预分配缓冲，解含非有限值时返回 false
+bool FitEngine::solveStep(Workspace& ws, double lambda) const
+{
+    int nParams = (int)ws.delta.size();
+    if (nParams == 0) return true;
+
+    switch (m_stepSolver) {
+    case StepSolver::QR:
+    case StepSolver::SVD: {
+        auto damped = ws.augmented.bottomRows(nParams);
+        damped.setZero();
+        damped.diagonal() = (lambda * ws.damping).cwiseSqrt();
+        if (m_stepSolver == StepSolver::QR) {
+            ws.qr.compute(ws.augmented);
+            ws.delta = ws.qr.solve(ws.rhs);
+        } else {
+            ws.svd.compute(ws.augmented);
+            ws.delta = ws.svd.solve(ws.rhs);
+        }
+        break;
+    }
+    case StepSolver::Cholesky:
+    default:
+        ws.Hlm = ws.H;
+        ws.Hlm.diagonal() += lambda * ws.damping;
+        ws.ldlt.compute(ws.Hlm);
+        ws.delta = ws.ldlt.solve(ws.negG);
+        break;
+    }
+    return ws.delta.allFinite();
+}
+
+// 用 solveStep 最近一次的分解求解测地线加速度 (H + lambda * D) * a = -J^T * r_vv，写入 ws.accel；
+// QR/SVD 时对应增广最小二乘 [J; sqrt(lambda * D)] a = [-r_vv; 0]
+bool FitEngine::solveAcceleration(Workspace& ws) const
+{
+    int nParams = (int)ws.accel.size();
+    if (nParams == 0) return true;
+
+    switch (m_stepSolver) {
+    case StepSolver::QR:
+    case StepSolver::SVD: {
+        int nRes = (int)ws.rvv.size();
+        ws.rhsAccel.head(nRes) = -ws.rvv;
+        ws.rhsAccel.tail(nParams).setZero();
+        if (m_stepSolver == StepSolver::QR) ws.accel = ws.qr.solve(ws.rhsAccel);
+        else ws.accel = ws.svd.solve(ws.rhsAccel);
+        break;
+    }
+    case StepSolver::Cholesky:
+    default:
+        ws.gAccel.noalias() = ws.J.transpose() * ws.rvv;
+        ws.gAccel = -ws.gAccel;
+        ws.accel = ws.ldlt.solve(ws.gAccel);
+        break;
+    }
+    return ws.accel.allFinite();
+}
@@ -0,0 +1,205 @@
+/*
+ * fitengine.h
+ * 文件作用: 试井曲线拟合引擎头文件 (不依赖界面)
+ * 功能描述:
+ * 1. 定义拟合参数结构 FitParameter (参数表格、参数选择对话框与拟合引擎共用)。
+ * 2. FitEngine 封装 Levenberg-Marquardt 拟合: 输入观测数据、模型类型、拟合参数表与压差/导数权重，
+ *    输出拟合结果；迭代进度与每次接受步长后的状态通过回调通知调用方。
+ * 3. 引擎自带求解器实例，不使用 ModelManager 或任何控件，可在批处理工具、基准测试中使用，
+ *    多个引擎可在不同线程中同时运行。停止请求可从任意线程发出。
+ * 4. 雅可比矩阵的各扰动求解相互独立，分发到拟合专用线程池并行计算，按下标组装，结果与线程数无关。
+ * 5. 残差、雅可比矩阵与正规方程使用每次拟合只分配一次的 Eigen 缓冲；步长方程可选正规方程 LDLT 分解，
+ *    或对增广最小二乘做 QR / SVD 分解 (病态问题)。
+ * 6. 雅可比矩阵可选 Broyden 秩一修正: 接受步长后按残差变化修正，只在步长质量下降、步长被拒绝
+ *    或每隔若干次迭代时重新做中心差分，减少每次拟合的模型求解次数。
+ * 7. 迭代策略可选: 固定倍数阻尼的 LM (默认)、Nielsen 阻尼更新、测地线加速 LM、信赖域折线法 (dogleg)。
+ */
+
+#ifndef FITENGINE_H
+#define FITENGINE_H
+
+#include <QList>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QSharedPointer>
+#include <atomic>
+#include <functional>
+#include <Eigen/Dense>
+#include "modelsolver01-06.h"
+#include "accuracyprofile.h"
+
+// 定义拟合参数结构体
+struct FitParameter {
+    QString name;           // 参数内部英文名 (例如 "k", "S")
+    QString displayName;    // 参数显示中文名 (例如 "渗透率")
+    double value;           // 当前参数值
+    bool isFit;             // 是否参与拟合 (true: 变量, false: 定值)
+    double min;             // 参数下限
+    double max;             // 参数上限
+    bool isVisible;         // 是否在主界面表格中显示
+};
+
+class QThreadPool;
+
+class FitEngine
+{
+public:
+    // 一次迭代的状态 (初始状态与每次接受步长后回调)
+    struct Iteration {
+        int iteration = 0;             // 0 为初始状态
+        double error = 0.0;            // 均方误差 (误差平方和 / 残差个数)
+        QMap<QString, double> params;  // 全部参数的当前值 (含 LfD)
+        ModelCurveData curve;          // 当前参数在默认时间序列上的理论曲线 (用于显示)
+    };
+
+    // 拟合结果
+    struct Result {
+        QMap<QString, double> params;  // 拟合后的全部参数值 (含 LfD)
+        double sse = 0.0;              // 误差平方和
+        double error = 0.0;            // 均方误差
+        int iterations = 0;            // 执行的迭代次数
+        int fittedCount = 0;           // 参与拟合的参数个数 (为零时未执行拟合)
+        int jacobianEvaluations = 0;   // 中心差分计算雅可比矩阵的次数
+        int modelSolves = 0;           // 残差计算的模型求解次数 (含雅可比差分，不含显示曲线)
+        bool converged = false;        // 均方误差达到收敛阈值
+        bool stopped = false;          // 因停止请求提前结束
+        ModelCurveData curve;          // 拟合参数按报告精度在默认时间序列上的理论曲线
+        AccuracySettings accuracy;     // 迭代使用的求解精度设置 (拟合档位的当前设置)
+        QStringList unmappedParameters; // 勾选拟合但求解器不认识的参数名 (非空时拒绝拟合，fittedCount 为零)
+        QStringList geometryParameters; // 设置了裂缝几何时勾选拟合的 nf、Lf、LfD (求解器按几何计算，非空时拒绝拟合)
+    };
+
+    // 迭代策略
+    enum class Strategy {
+        LevenbergMarquardt, // 阻尼 lambda 接受时除以 10、拒绝时乘以 10，每次迭代最多 5 次尝试 (默认)
+        Nielsen,            // LM + Nielsen 阻尼更新: 按步长质量连续调整 lambda，连续拒绝时倍数逐次加倍
+        Geodesic,           // LM + 测地线加速 (Transtrum-Sethna): 每次尝试多一次求解，以二阶修正沿弯曲的谷底前进 (Nielsen 阻尼)
+        Dogleg              // 信赖域折线法: Gauss-Newton 步与 Cauchy 步按信赖域半径组合
+    };
+
+    // LM 步长方程的解法
+    enum class StepSolver {
+        Cholesky, // 正规方程 (J^T J + lambda D) delta = -J^T r 的 LDLT 分解 (默认，最快)
+        QR,       // 增广最小二乘 [J; sqrt(lambda D)] delta = [-r; 0] 的列主元 QR 分解，条件数不平方，适合病态问题
+        SVD       // 同上，使用奇异值分解 (最稳健，秩亏时给出最小范数解，最慢)
+    };
+
+    // 雅可比矩阵的更新方式
+    enum class JacobianUpdate {
+        FiniteDifference, // 每次迭代重新中心差分 (默认)
+        Broyden           // 接受步长后做 Broyden 秩一修正，按需重新差分
+    };
+
+    using IterationCallback = std::function<void(const Iteration&)>;
+    using ProgressCallback = std::function<void(int percent)>;
+
+    explicit FitEngine(ModelSolver01_06::ModelType type);
+
+    ModelSolver01_06::ModelType modelType() const { return m_type; }
+
+    // 观测数据: 时间、压差与压差导数 (压差与导数按下标与时间对应)
+    void setObservedData(const QVector<double>& t, const QVector<double>& deltaP, const QVector<double>& derivative);
+    // 参数表: isFit 的参数参与拟合，其余为定值
+    void setParameters(const QList<FitParameter>& params);
+    // 压差残差权重，导数残差权重为 1 - weight
+    void setWeight(double weight);
+    // 裂缝几何 (为空时使用等间距布置)
+    void setGeometry(const QSharedPointer<const FractureGeometry>& geometry);
+    // 求解统计记录 (可为空)，拟合中的所有模型计算累加到该记录
+    void setSolverStats(SolverStats* stats);
+    void setMaxIterations(int maxIterations);
+    void setStrategy(Strategy strategy);
+    void setStepSolver(StepSolver solver);
+    // Broyden 模式下最多连续 refreshInterval 次迭代使用修正的 J，之后重新差分
+    void setJacobianUpdate(JacobianUpdate update, int refreshInterval = kBroydenRefreshInterval);
+
+    // 回调在调用 run() 的线程中执行
+    void setIterationCallback(const IterationCallback& callback);
+    void setProgressCallback(const ProgressCallback& callback);
+
+    // 执行拟合 (阻塞)；结束时清除停止请求。有勾选拟合但没有求解器参数槽位的参数、或被裂缝几何取代的参数时不拟合，
+    // 见 Result::unmappedParameters 与 Result::geometryParameters
+    Result run();
+
+    // 参数表中勾选拟合、但在求解器参数块 (ModelParams) 中没有对应槽位的参数名
+    static QStringList unmappedParameters(const QList<FitParameter>& params);
+    // 设置了 (非空) 裂缝几何时，参数表中勾选拟合、但求解器改按几何计算而不使用的参数名 (裂缝数 nf 与半长 Lf、LfD)
+    static QStringList geometryParameters(const QList<FitParameter>& params, const QSharedPointer<const FractureGeometry>& geometry);
+
+    // 请求停止 (线程安全)，当前迭代结束后返回已得到的结果
+    void requestStop();
+    bool stopRequested() const;
+
+    // 雅可比扰动求解并行的最大线程数 (全局设置，<=0 表示使用 CPU 核心数，1 表示串行)
+    static void setMaxThreadCount(int count);
+    static int maxThreadCount();
+
+    // 均方误差低于该值时视为收敛
+    static constexpr double kConvergedError = 3e-3;
+    // Broyden 模式的默认刷新间隔，及触发重新差分的步长质量下限 (实际下降量 / 线性模型预测下降量)
+    static const int kBroydenRefreshInterval = 5;
+    static constexpr double kBroydenMinStepQuality = 0.25;
+
+private:
+    struct Workspace;
+
+    // Nielsen、测地线加速与折线法每次迭代的最多尝试次数
+    static const int kMaxTrials = 10;
+    // 测地线加速: 二阶方向导数的差分步长 (相对速度) 与最短探测距离 (与雅可比对数差分步长相同)，及允许的 |2a| / |v| 上限
+    static constexpr double kGeodesicProbeStep = 0.1;
+    static constexpr double kGeodesicMinProbe = 0.01;
+    static constexpr double kGeodesicMaxRatio = 0.75;
+    // 折线法: 初始、最小与最大信赖域半径 (对数参数以 log10 计)，及 Gauss-Newton 步的正则化阻尼
+    static constexpr double kDoglegInitialRadius = 1.0;
+    static constexpr double kDoglegMinRadius = 1e-8;
+    static constexpr double kDoglegMaxRadius = 10.0;
+    static constexpr double kDoglegGaussNewtonDamping = 1e-10;
+
+    // 残差个数 (压差残差与导数残差之和)
+    int residualCount() const;
+    // 残差由 solver 计算后写入 out (并行的雅可比任务各用一个求解器实例，各写缓冲的一列)；理论曲线点数不足时置零并返回 false
+    bool calculateResiduals(const ModelSolver01_06& solver, const ModelParams& params, const SolverOptions& options,
+                            Eigen::Ref<Eigen::VectorXd> out) const;
+    // 中心差分雅可比矩阵，写入 ws.J
+    void computeJacobian(const ModelParams& params, const QVector<int>& fitIndices, const QVector<int>& fitSlots,
+                         const SolverOptions& options, Workspace& ws) const;
+    // 按步长更新拟合参数并约束在上下限内，step 写入约束后的实际步长
+    void applyStep(const ModelParams& current, const Eigen::VectorXd& delta, const QVector<int>& fitIndices,
+                   const QVector<int>& fitSlots, ModelParams& trial, Eigen::VectorXd& step) const;
+    // 按接受的步长 ws.step 对 ws.J 做 Broyden 秩一修正 (ws.residuals 为旧残差，ws.trialResiduals 为新残差)；
+    // 步长质量低于下限或无法修正时返回 false
+    bool broydenUpdate(Workspace& ws, double quality) const;
+    // 按阻尼 lambda 求解步长，写入 ws.delta；解含非有限值时返回 false
+    bool solveStep(Workspace& ws, double lambda) const;
+    // 用最近一次步长求解的分解求解测地线加速度，写入 ws.accel
+    bool solveAcceleration(Workspace& ws) const;
+    // 对数空间更新的参数 (表皮与裂缝条数按线性更新)
+    static bool isLogParameter(const QString& name, double value);
+
+    // 雅可比扰动求解专用线程池 (与拟合任务所在的全局线程池、求解器的时间点线程池分离，相互之间不会等待)
+    static QThreadPool* jacobianThreadPool();
+
+    ModelSolver01_06::ModelType m_type;
+    ModelSolver01_06 m_solver;
+
+    QVector<double> m_obsTime;
+    QVector<double> m_obsDeltaP;
+    QVector<double> m_obsDerivative;
+    QList<FitParameter> m_params;
+    double m_weight = 0.5;
+    QSharedPointer<const FractureGeometry> m_geometry;
+    SolverStats* m_stats = nullptr;
+    int m_maxIterations = 50;
+    Strategy m_strategy = Strategy::LevenbergMarquardt;
+    StepSolver m_stepSolver = StepSolver::Cholesky;
+    JacobianUpdate m_jacobianUpdate = JacobianUpdate::FiniteDifference;
+    int m_jacobianRefreshInterval = kBroydenRefreshInterval;
+
+    IterationCallback m_onIteration;
+    ProgressCallback m_onProgress;
+    std::atomic<bool> m_stopRequested;
+};
+
+#endif // FITENGINE_H
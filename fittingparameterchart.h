@@ -6,17 +6,7 @@
 #include <QList>
 #include <QMap>
 #include "modelmanager.h"
-
-// 定义拟合参数结构体
-struct FitParameter {
-    QString name;           // 参数内部英文名 (例如 "k", "S")
-    QString displayName;    // 参数显示中文名 (例如 "渗透率")
-    double value;           // 当前参数值
-    bool isFit;             // 是否参与拟合 (true: 变量, false: 定值)
-    double min;             // 参数下限
-    double max;             // 参数上限
-    bool isVisible;         // 是否在主界面表格中显示
-};
+#include "fitengine.h" // FitParameter 定义
 
 // 拟合参数图表管理类
 class FittingParameterChart : public QObject
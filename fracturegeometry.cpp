@@ -0,0 +1,121 @@
+/*
+ * fracturegeometry.cpp
+ * 文件作用: 裂缝几何描述实现
+ * 功能描述:
+ * 1. 等间距布置生成、裂缝段追加、等间距判断与交叠检查。
+ * 2. JSON 读写与缓存键生成。
+ */
+
+#include "fracturegeometry.h"
+
+#include <QJsonArray>
+#include <cmath>
+#include <algorithm>
+
+FractureGeometry FractureGeometry::uniform(int nf, double halfLength, double yD)
+{
+    FractureGeometry g;
+    if (nf < 1) nf = 1;
+    if (nf == 1) {
+        g.append(0.0, yD, halfLength);
+    } else {
+        double start = -0.9;
+        double end = 0.9;
+        double step = (end - start) / (nf - 1);
+        for (int i = 0; i < nf; ++i) g.append(start + i * step, yD, halfLength);
+    }
+    return g;
+}
+
+void FractureGeometry::append(double xD, double yD, double halfLength)
+{
+    if (!(halfLength > 0.0) || !std::isfinite(xD) || !std::isfinite(yD)) return;
+    m_x.append(xD);
+    m_y.append(yD);
+    m_halfLength.append(halfLength);
+}
+
+void FractureGeometry::append(const FractureGeometry& other)
+{
+    m_x += other.m_x;
+    m_y += other.m_y;
+    m_halfLength += other.m_halfLength;
+}
+
+void FractureGeometry::clear()
+{
+    m_x.clear();
+    m_y.clear();
+    m_halfLength.clear();
+}
+
+bool FractureGeometry::isUniform() const
+{
+    int n = size();
+    if (n < 2) return false;
+    double step = m_x[1] - m_x[0];
+    double tol = 1e-12 * std::max(1.0, std::abs(step));
+    for (int i = 1; i < n; ++i) {
+        if (std::abs((m_x[i] - m_x[i - 1]) - step) > tol) return false;
+        if (std::abs(m_y[i] - m_y[0]) > tol) return false;
+        if (std::abs(m_halfLength[i] - m_halfLength[0]) > 1e-12 * m_halfLength[0]) return false;
+    }
+    return true;
+}
+
+bool FractureGeometry::findOverlap(int* first, int* second) const
+{
+    int n = size();
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            double scale = std::max(m_halfLength[i], m_halfLength[j]);
+            if (std::abs(m_y[i] - m_y[j]) > 1e-12 * std::max(1.0, std::abs(m_y[i]))) continue;
+            if (std::abs(m_x[i] - m_x[j]) >= m_halfLength[i] + m_halfLength[j] - 1e-12 * scale) continue;
+            if (first) *first = i;
+            if (second) *second = j;
+            return true;
+        }
+    }
+    return false;
+}
+
+FractureGeometry FractureGeometry::fromJson(const QJsonObject& obj)
+{
+    FractureGeometry g;
+    QJsonArray arr = obj.value("fractures").toArray();
+    for (const QJsonValue& v : arr) {
+        QJsonObject f = v.toObject();
+        if (!f.contains("x") || !f.contains("halfLength")) return FractureGeometry();
+        double halfLength = f.value("halfLength").toDouble();
+        if (!(halfLength > 0.0)) return FractureGeometry();
+        g.append(f.value("x").toDouble(), f.value("y").toDouble(0.0), halfLength);
+    }
+    if (g.findOverlap()) return FractureGeometry();
+    return g;
+}
+
+QJsonObject FractureGeometry::toJson() const
+{
+    QJsonArray arr;
+    for (int i = 0; i < size(); ++i) {
+        QJsonObject f;
+        f["x"] = m_x[i];
+        f["y"] = m_y[i];
+        f["halfLength"] = m_halfLength[i];
+        arr.append(f);
+    }
+    QJsonObject obj;
+    obj["fractures"] = arr;
+    return obj;
+}
+
+QByteArray FractureGeometry::key() const
+{
+    QByteArray key;
+    int n = size();
+    key.append(reinterpret_cast<const char*>(&n), sizeof(n));
+    key.append(reinterpret_cast<const char*>(m_x.constData()), n * sizeof(double));
+    key.append(reinterpret_cast<const char*>(m_y.constData()), n * sizeof(double));
+    key.append(reinterpret_cast<const char*>(m_halfLength.constData()), n * sizeof(double));
+    return key;
+}
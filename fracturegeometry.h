@@ -0,0 +1,61 @@
+/*
+ * fracturegeometry.h
+ * 文件作用: 裂缝几何描述头文件
+ * 功能描述:
+ * 1. 以裂缝段列表描述任意完井布置: 每段给出中心坐标 (xD, yD) 与半长 LfD (与 xwD、LfD 相同的无因次坐标)，
+ *    裂缝段沿 x 方向展布。支持非等间距分段、各段半长不同以及多分支 (不同 yD) 布置。
+ * 2. 提供 JSON 读写 ({"fractures": [{"x":..,"y":..,"halfLength":..}, ...]})，随项目文件保存。
+ *    同一分支上交叠或重复的裂缝段使影响矩阵奇异，读入时拒绝，编辑界面据 findOverlap 提示。
+ * 3. 提供与原等间距布置一致的生成函数及判断等间距等长布置的辅助函数 (可用 Toeplitz 快速求解)。
+ * 4. 纯数据类，不依赖 UI 控件；求解器以共享只读指针引用 (ModelParams::geometry)。
+ */
+
+#ifndef FRACTUREGEOMETRY_H
+#define FRACTUREGEOMETRY_H
+
+#include <QVector>
+#include <QByteArray>
+#include <QJsonObject>
+
+class FractureGeometry
+{
+public:
+    FractureGeometry() {}
+
+    // 原等间距布置: nf 条等长裂缝，中心在 yD 处沿 [-0.9, 0.9] 均匀分布 (单条时位于原点)
+    static FractureGeometry uniform(int nf, double halfLength, double yD = 0.0);
+
+    // 追加一段裂缝，半长必须为正
+    void append(double xD, double yD, double halfLength);
+    // 追加另一几何中的全部裂缝段 (组合多分支布置)
+    void append(const FractureGeometry& other);
+    void clear();
+
+    int size() const { return m_x.size(); }
+    bool isEmpty() const { return m_x.isEmpty(); }
+
+    const QVector<double>& x() const { return m_x; }
+    const QVector<double>& y() const { return m_y; }
+    const QVector<double>& halfLength() const { return m_halfLength; }
+
+    // 所有裂缝段半长相同且共线等间距 (影响矩阵为对称 Toeplitz 矩阵)
+    bool isUniform() const;
+
+    // 同一分支 (yD 相同) 上相互交叠的两段 (含中心与半长都相同的重复段，影响矩阵奇异)；
+    // 找到时返回 true 并给出两段的下标 (first < second)，首尾相接不算交叠
+    bool findOverlap(int* first = nullptr, int* second = nullptr) const;
+
+    // JSON 读写；格式错误、裂缝段无效或同一分支上有交叠段时返回空几何
+    static FractureGeometry fromJson(const QJsonObject& obj);
+    QJsonObject toJson() const;
+
+    // 几何内容的二进制键 (用于缓存键，内容相同则键相同)
+    QByteArray key() const;
+
+private:
+    QVector<double> m_x;
+    QVector<double> m_y;
+    QVector<double> m_halfLength;
+};
+
+#endif // FRACTUREGEOMETRY_H
@@ -0,0 +1,274 @@
+/*
+ * fracturegeometrydialog.cpp
+ * 文件作用: 裂缝几何编辑对话框实现
+ * 功能描述:
+ * 1. 构建裂缝段表格与操作按钮 (代码构建界面，风格与数据计算对话框一致)。
+ * 2. 实现文本 / JSON 文件导入、等间距布置生成与表格内容校验 (数值有效、同一分支上不交叠)。
+ */
+
+#include "fracturegeometrydialog.h"
+
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QHeaderView>
+#include <QFileDialog>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMessageBox>
+#include <QRegularExpression>
+#include <algorithm>
+#include <functional>
+
+FractureGeometryDialog::FractureGeometryDialog(const FractureGeometry& current, int nf, double LfD, QWidget* parent)
+    : QDialog(parent), m_nf(nf), m_LfD(LfD), m_geometry(current)
+{
+    setupUI();
+    fillTable(current);
+}
+
+void FractureGeometryDialog::setupUI()
+{
+    setWindowTitle("裂缝几何");
+    resize(520, 480);
+    setStyleSheet("QDialog { background-color: white; color: black; font-family: \"Microsoft YaHei\", Arial; } "
+                  "QLabel { color: black; background: transparent; } "
+                  "QTableWidget { color: black; background-color: white; gridline-color: #ccc; } "
+                  "QHeaderView::section { color: black; background-color: #f0f0f0; border: 1px solid #ccc; padding: 2px; } "
+                  "QPushButton { color: white; background-color: #4a90e2; border: none; border-radius: 4px; padding: 6px 12px; } "
+                  "QPushButton:hover { background-color: #357abd; }");
+
+    QVBoxLayout* mainLayout = new QVBoxLayout(this);
+
+    QLabel* hint = new QLabel("每段裂缝给出中心坐标 x<sub>D</sub>、y<sub>D</sub> 与半长 L<sub>fD</sub> (与 L<sub>fD</sub> 相同的无因次坐标)，"
+                              "裂缝段沿 x 方向展布。表格为空时按模型参数 n<sub>f</sub> 等间距布置计算。");
+    hint->setWordWrap(true);
+    mainLayout->addWidget(hint);
+
+    m_table = new QTableWidget(0, 3);
+    m_table->setHorizontalHeaderLabels({ "x (无因次)", "y (无因次)", "半长 (无因次)" });
+    m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    connect(m_table, &QTableWidget::itemChanged, this, &FractureGeometryDialog::updateSummary);
+    mainLayout->addWidget(m_table);
+
+    m_summaryLabel = new QLabel;
+    m_summaryLabel->setStyleSheet("color: #666;");
+    mainLayout->addWidget(m_summaryLabel);
+
+    // 表格操作
+    QHBoxLayout* editLayout = new QHBoxLayout;
+    QPushButton* btnAdd = new QPushButton("添加");
+    QPushButton* btnRemove = new QPushButton("删除选中");
+    QPushButton* btnUniform = new QPushButton(QString("按 nf = %1 等间距生成").arg(m_nf));
+    QPushButton* btnImport = new QPushButton("从文件导入...");
+    QPushButton* btnClear = new QPushButton("清空");
+    connect(btnAdd, &QPushButton::clicked, this, &FractureGeometryDialog::onAddRow);
+    connect(btnRemove, &QPushButton::clicked, this, &FractureGeometryDialog::onRemoveRows);
+    connect(btnUniform, &QPushButton::clicked, this, &FractureGeometryDialog::onGenerateUniform);
+    connect(btnImport, &QPushButton::clicked, this, &FractureGeometryDialog::onImport);
+    connect(btnClear, &QPushButton::clicked, this, &FractureGeometryDialog::onClear);
+    editLayout->addWidget(btnAdd);
+    editLayout->addWidget(btnRemove);
+    editLayout->addWidget(btnUniform);
+    editLayout->addWidget(btnImport);
+    editLayout->addWidget(btnClear);
+    mainLayout->addLayout(editLayout);
+
+    // 底部按钮
+    QHBoxLayout* btnLayout = new QHBoxLayout;
+    btnLayout->addStretch();
+    QPushButton* btnOk = new QPushButton("确定");
+    QPushButton* btnCancel = new QPushButton("取消");
+    btnOk->setStyleSheet("background-color: #28a745; color: white;");
+    btnCancel->setStyleSheet("background-color: #6c757d; color: white;");
+    connect(btnOk, &QPushButton::clicked, this, &FractureGeometryDialog::onConfirm);
+    connect(btnCancel, &QPushButton::clicked, this, &QDialog::reject);
+    btnLayout->addWidget(btnOk);
+    btnLayout->addWidget(btnCancel);
+    mainLayout->addLayout(btnLayout);
+}
+
+void FractureGeometryDialog::fillTable(const FractureGeometry& geometry)
+{
+    m_table->blockSignals(true);
+    m_table->setRowCount(geometry.size());
+    for (int i = 0; i < geometry.size(); ++i) {
+        m_table->setItem(i, 0, new QTableWidgetItem(QString::number(geometry.x()[i], 'g', 10)));
+        m_table->setItem(i, 1, new QTableWidgetItem(QString::number(geometry.y()[i], 'g', 10)));
+        m_table->setItem(i, 2, new QTableWidgetItem(QString::number(geometry.halfLength()[i], 'g', 10)));
+    }
+    m_table->blockSignals(false);
+    updateSummary();
+}
+
+void FractureGeometryDialog::updateSummary()
+{
+    FractureGeometry geometry;
+    int badRow = -1;
+    QString error;
+    if (m_table->rowCount() == 0) {
+        m_summaryLabel->setText(QString("未设置裂缝几何，按 nf = %1 等间距布置计算").arg(m_nf));
+    } else if (!collect(geometry, &badRow, &error)) {
+        m_summaryLabel->setText(error);
+    } else {
+        m_summaryLabel->setText(QString("%1 段裂缝%2").arg(geometry.size())
+                                .arg(geometry.isUniform() ? "，等间距等长 (Toeplitz 快速求解)" : ""));
+    }
+}
+
+bool FractureGeometryDialog::collect(FractureGeometry& geometry, int* badRow, QString* error) const
+{
+    geometry.clear();
+    for (int r = 0; r < m_table->rowCount(); ++r) {
+        double v[3];
+        bool valid = true;
+        for (int c = 0; c < 3 && valid; ++c) {
+            QTableWidgetItem* item = m_table->item(r, c);
+            valid = false;
+            v[c] = item ? item->text().trimmed().toDouble(&valid) : 0.0;
+        }
+        int before = geometry.size();
+        if (valid) geometry.append(v[0], v[1], v[2]);
+        if (geometry.size() == before) { // 非数值或 append 拒绝的无效段
+            if (badRow) *badRow = r;
+            if (error) *error = QString("第 %1 行数值无效：坐标必须为数值，半长必须为正").arg(r + 1);
+            return false;
+        }
+    }
+    int first = -1, second = -1;
+    if (geometry.findOverlap(&first, &second)) {
+        if (badRow) *badRow = second;
+        if (error) *error = QString("第 %1 行与第 %2 行的裂缝段在同一分支上交叠或重复 (影响矩阵奇异)，请修改或删除其中一段")
+                                .arg(first + 1).arg(second + 1);
+        return false;
+    }
+    return true;
+}
+
+void FractureGeometryDialog::onAddRow()
+{
+    // 新段默认沿用末行的 y 与半长，中心放在末行裂缝段之后 (首尾相接，不与末行交叠)
+    QString x = "0", y = "0", halfLength = QString::number(m_LfD, 'g', 10);
+    int last = m_table->rowCount() - 1;
+    if (last >= 0) {
+        if (m_table->item(last, 1)) y = m_table->item(last, 1)->text();
+        if (m_table->item(last, 2)) halfLength = m_table->item(last, 2)->text();
+        bool okX = false, okHalf = false;
+        double lastX = m_table->item(last, 0) ? m_table->item(last, 0)->text().trimmed().toDouble(&okX) : 0.0;
+        double lastHalf = halfLength.trimmed().toDouble(&okHalf);
+        if (okX && okHalf) x = QString::number(lastX + 2.0 * lastHalf, 'g', 10);
+    }
+    m_table->blockSignals(true);
+    m_table->insertRow(last + 1);
+    m_table->setItem(last + 1, 0, new QTableWidgetItem(x));
+    m_table->setItem(last + 1, 1, new QTableWidgetItem(y));
+    m_table->setItem(last + 1, 2, new QTableWidgetItem(halfLength));
+    m_table->blockSignals(false);
+    m_table->editItem(m_table->item(last + 1, 0));
+    updateSummary();
+}
+
+void FractureGeometryDialog::onRemoveRows()
+{
+    QList<int> rows;
+    for (const QModelIndex& index : m_table->selectionModel()->selectedRows()) rows.append(index.row());
+    std::sort(rows.begin(), rows.end(), std::greater<int>());
+    for (int r : rows) m_table->removeRow(r);
+    updateSummary();
+}
+
+void FractureGeometryDialog::onGenerateUniform()
+{
+    if (!(m_LfD > 0.0)) {
+        QMessageBox::warning(this, "裂缝几何", "模型参数中的 LfD 无效，无法生成等间距布置");
+        return;
+    }
+    fillTable(FractureGeometry::uniform(m_nf, m_LfD));
+}
+
+void FractureGeometryDialog::onImport()
+{
+    QString filePath = QFileDialog::getOpenFileName(this, "导入裂缝几何", QString(),
+                                                    "裂缝几何 (*.txt *.csv *.dat *.json *.pwt);;所有文件 (*.*)");
+    if (filePath.isEmpty()) return;
+    QString error;
+    FractureGeometry geometry = readFile(filePath, &error);
+    if (geometry.isEmpty()) {
+        QMessageBox::warning(this, "导入裂缝几何", error);
+        return;
+    }
+    fillTable(geometry);
+}
+
+void FractureGeometryDialog::onClear()
+{
+    m_table->setRowCount(0);
+    updateSummary();
+}
+
+void FractureGeometryDialog::onConfirm()
+{
+    FractureGeometry geometry;
+    int badRow = -1;
+    QString error;
+    if (!collect(geometry, &badRow, &error)) {
+        QMessageBox::warning(this, "裂缝几何", error);
+        m_table->selectRow(badRow);
+        return;
+    }
+    m_geometry = geometry;
+    accept();
+}
+
+// 文本文件: 每行 x、y、halfLength 三个数 (逗号、分号、制表符或空格分隔)，不能解析的行 (表头、注释) 跳过；
+// JSON 文件: 裂缝几何对象 {"fractures": [...]}，或含 "fracture_geometry" 的项目文件；
+// 同一分支上有交叠或重复的裂缝段时整个文件拒绝导入
+FractureGeometry FractureGeometryDialog::readFile(const QString& filePath, QString* error)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (error) *error = QString("无法打开文件 %1").arg(filePath);
+        return FractureGeometry();
+    }
+
+    QString suffix = QFileInfo(filePath).suffix().toLower();
+    if (suffix == "json" || suffix == "pwt") {
+        QJsonParseError parseError;
+        QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+        if (parseError.error != QJsonParseError::NoError || !doc.isObject()) {
+            if (error) *error = QString("JSON 格式错误: %1").arg(parseError.errorString());
+            return FractureGeometry();
+        }
+        QJsonObject root = doc.object();
+        if (root.contains("fracture_geometry")) root = root.value("fracture_geometry").toObject();
+        FractureGeometry geometry = FractureGeometry::fromJson(root);
+        if (geometry.isEmpty() && error) {
+            *error = "文件中没有有效的裂缝段 (需要 fractures 数组，每段含 x 与正的 halfLength，且同一分支上的裂缝段不能交叠或重复)";
+        }
+        return geometry;
+    }
+
+    FractureGeometry geometry;
+    QTextStream in(&file);
+    static const QRegularExpression separator("[,;\\s]+");
+    while (!in.atEnd()) {
+        QStringList parts = in.readLine().trimmed().split(separator, Qt::SkipEmptyParts);
+        if (parts.size() < 3) continue;
+        bool okX = false, okY = false, okL = false;
+        double x = parts[0].toDouble(&okX);
+        double y = parts[1].toDouble(&okY);
+        double halfLength = parts[2].toDouble(&okL);
+        if (okX && okY && okL) geometry.append(x, y, halfLength);
+    }
+    if (geometry.isEmpty() && error) *error = "文件中没有有效的裂缝段 (每行需要 x, y, halfLength 三个数值，半长为正)";
+    int first = -1, second = -1;
+    if (geometry.findOverlap(&first, &second)) {
+        if (error) *error = QString("第 %1 段与第 %2 段裂缝在同一分支上交叠或重复 (影响矩阵奇异)").arg(first + 1).arg(second + 1);
+        return FractureGeometry();
+    }
+    return geometry;
+}
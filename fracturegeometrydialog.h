@@ -0,0 +1,56 @@
+/*
+ * fracturegeometrydialog.h
+ * 文件作用: 裂缝几何编辑对话框头文件
+ * 功能描述:
+ * 1. 以裂缝段表格 (中心 xD、yD 与半长 LfD，与模型参数相同的无因次坐标) 编辑任意完井布置。
+ * 2. 支持逐段增删、按当前 nf 与 LfD 生成等间距布置，以及从文本文件 (每行 x, y, halfLength) 或
+ *    JSON 文件 (裂缝几何对象或含 fracture_geometry 的 .pwt 项目文件) 导入。
+ * 3. 表格为空表示不使用自定义几何，求解器按模型参数 nf 的等间距布置计算。
+ * 4. 同一分支上交叠或重复的裂缝段 (影响矩阵奇异) 在编辑与导入时均被拒绝并提示。
+ */
+
+#ifndef FRACTUREGEOMETRYDIALOG_H
+#define FRACTUREGEOMETRYDIALOG_H
+
+#include <QDialog>
+#include <QTableWidget>
+#include <QLabel>
+#include "fracturegeometry.h"
+
+class FractureGeometryDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    // current: 项目中已保存的几何 (为空时表格为空)；nf、LfD: 模型参数页的当前值，用于生成等间距布置
+    FractureGeometryDialog(const FractureGeometry& current, int nf, double LfD, QWidget* parent = nullptr);
+
+    // 用户确认后的几何 (表格为空时为空几何)
+    FractureGeometry geometry() const { return m_geometry; }
+
+    // 从文件读取裂缝几何，失败时返回空几何并给出原因
+    static FractureGeometry readFile(const QString& filePath, QString* error = nullptr);
+
+private slots:
+    void onAddRow();
+    void onRemoveRows();
+    void onGenerateUniform();
+    void onImport();
+    void onClear();
+    void onConfirm();
+
+private:
+    void setupUI();
+    void fillTable(const FractureGeometry& geometry);
+    void updateSummary();
+    // 由表格内容组装几何；某行数值无效或与前面某行在同一分支上交叠时返回 false，并给出该行行号与原因
+    bool collect(FractureGeometry& geometry, int* badRow, QString* error) const;
+
+    QTableWidget* m_table;
+    QLabel* m_summaryLabel;
+    int m_nf;
+    double m_LfD;
+    FractureGeometry m_geometry;
+};
+
+#endif // FRACTUREGEOMETRYDIALOG_H
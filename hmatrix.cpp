@@ -0,0 +1,408 @@
+/*
+ * hmatrix.cpp
+ * 文件作用: 层次低秩矩阵 (H 矩阵) 与迭代求解实现
+ * 功能描述:
+ * 1. 聚类树与块树的递归构建，远场块 ACA 压缩 (秩过高时改为稠密块，沿用 ACA 已求值的行与列)。
+ * 2. 矩阵-向量乘、块对角预条件与 GMRES(restart) (复数 Givens 旋转，实数时退化为普通旋转)。
+ */
+
+#include "hmatrix.h"
+
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+// ACA 中连续遇到可忽略残差行的次数上限 (超过则认为远场块已近似完毕)
+const int kMaxNegligibleRows = 3;
+
+inline double conjugate(double v) { return v; }
+inline std::complex<double> conjugate(std::complex<double> v) { return std::conj(v); }
+
+// 两个包围盒之间的距离与包围盒直径
+inline double boxDistance(double ax0, double ax1, double ay0, double ay1, double bx0, double bx1, double by0, double by1)
+{
+    double dx = std::max(0.0, std::max(ax0 - bx1, bx0 - ax1));
+    double dy = std::max(0.0, std::max(ay0 - by1, by0 - ay1));
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+inline double boxDiameter(double x0, double x1, double y0, double y1)
+{
+    return std::sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+}
+
+} // namespace
+
+template <typename T>
+void HMatrix<T>::build(const QVector<double>& x, const QVector<double>& y, const QVector<double>& radius,
+                       const EntryFunction& entry, const Options& options)
+{
+    int n = x.size();
+    m_perm.resize(n);
+    std::iota(m_perm.begin(), m_perm.end(), 0);
+    m_clusters.clear();
+    m_blocks.clear();
+    m_diagBlocks.clear();
+    m_diagLU.clear();
+    m_evaluated = 0;
+    if (n == 0) return;
+
+    int root = buildCluster(x, y, radius, 0, n, std::max(1, options.leafSize));
+    buildBlocks(root, root, options.eta);
+
+    // 先填充近场稠密块并得到元素量级，再压缩远场块 (量级用于判断可忽略的远场块)
+    m_scale = 0.0;
+    for (Block& blk : m_blocks) {
+        if (blk.admissible) continue;
+        fillDense(m_clusters[blk.row], m_clusters[blk.col], entry, blk.dense);
+        m_scale = std::max(m_scale, blk.dense.cwiseAbs().maxCoeff());
+    }
+    for (Block& blk : m_blocks) {
+        if (!blk.admissible) continue;
+        blk.lowRank = aca(m_clusters[blk.row], m_clusters[blk.col], entry, options.acaTolerance, blk);
+    }
+
+    m_diagLU.resize(m_diagBlocks.size());
+    for (int i = 0; i < m_diagBlocks.size(); ++i) {
+        m_diagLU[i].compute(m_blocks[m_diagBlocks[i]].dense);
+    }
+}
+
+// 聚类: 计算区间内点的包围盒，沿较长边按中心坐标的中位数二分，直到点数不超过 leafSize
+template <typename T>
+int HMatrix<T>::buildCluster(const QVector<double>& x, const QVector<double>& y, const QVector<double>& radius,
+                             int begin, int end, int leafSize)
+{
+    Cluster c;
+    c.begin = begin;
+    c.end = end;
+    c.xmin = c.ymin = HUGE_VAL;
+    c.xmax = c.ymax = -HUGE_VAL;
+    for (int k = begin; k < end; ++k) {
+        int i = m_perm[k];
+        c.xmin = std::min(c.xmin, x[i] - radius[i]);
+        c.xmax = std::max(c.xmax, x[i] + radius[i]);
+        c.ymin = std::min(c.ymin, y[i]);
+        c.ymax = std::max(c.ymax, y[i]);
+    }
+    int index = m_clusters.size();
+    m_clusters.append(c);
+
+    if (end - begin > leafSize) {
+        bool alongX = (c.xmax - c.xmin) >= (c.ymax - c.ymin);
+        int mid = begin + (end - begin) / 2;
+        std::nth_element(m_perm.begin() + begin, m_perm.begin() + mid, m_perm.begin() + end, [&](int a, int b) {
+            return alongX ? x[a] < x[b] : y[a] < y[b];
+        });
+        int left = buildCluster(x, y, radius, begin, mid, leafSize);
+        int right = buildCluster(x, y, radius, mid, end, leafSize);
+        m_clusters[index].child[0] = left;
+        m_clusters[index].child[1] = right;
+    }
+    return index;
+}
+
+// 块树: 可容许块记为远场块 (之后尝试 ACA 压缩)，两簇均为叶簇的不可容许块为近场稠密块，其余继续细分
+template <typename T>
+void HMatrix<T>::buildBlocks(int a, int b, double eta)
+{
+    const Cluster ra = m_clusters[a];
+    const Cluster cb = m_clusters[b];
+    double dist = boxDistance(ra.xmin, ra.xmax, ra.ymin, ra.ymax, cb.xmin, cb.xmax, cb.ymin, cb.ymax);
+    double diam = std::max(boxDiameter(ra.xmin, ra.xmax, ra.ymin, ra.ymax), boxDiameter(cb.xmin, cb.xmax, cb.ymin, cb.ymax));
+
+    if ((dist > 0.0 && diam <= eta * dist) || (ra.isLeaf() && cb.isLeaf())) {
+        Block blk;
+        blk.row = a;
+        blk.col = b;
+        blk.admissible = dist > 0.0 && diam <= eta * dist;
+        if (a == b) m_diagBlocks.append(m_blocks.size());
+        m_blocks.append(blk);
+        return;
+    }
+
+    int rowsSplit[2] = { a, -1 }, colsSplit[2] = { b, -1 };
+    if (!ra.isLeaf()) { rowsSplit[0] = ra.child[0]; rowsSplit[1] = ra.child[1]; }
+    if (!cb.isLeaf()) { colsSplit[0] = cb.child[0]; colsSplit[1] = cb.child[1]; }
+    for (int i = 0; i < 2 && rowsSplit[i] >= 0; ++i) {
+        for (int j = 0; j < 2 && colsSplit[j] >= 0; ++j) {
+            buildBlocks(rowsSplit[i], colsSplit[j], eta);
+        }
+    }
+}
+
+template <typename T>
+void HMatrix<T>::fillDense(const Cluster& rows, const Cluster& cols, const EntryFunction& entry, Matrix& out)
+{
+    int m = rows.size(), n = cols.size();
+    out.resize(m, n);
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            out(i, j) = entry(m_perm[rows.begin + i], m_perm[cols.begin + j]);
+        }
+    }
+    m_evaluated += (qint64)m * n;
+}
+
+// 部分选主元 ACA: 交替取残差行与残差列，秩一修正的范数相对于近似矩阵范数 (递推估计，不低于近场元素量级)
+// 小于 tol 时停止并存为低秩块；秩超过 m·n/(m+n) (低秩存储不再节省) 时改存稠密块并返回 false，
+// 此时已求值的行与列直接写入稠密块，只补算其余元素 (每个元素至多求值一次，求值量不超过稠密填充)
+template <typename T>
+bool HMatrix<T>::aca(const Cluster& rows, const Cluster& cols, const EntryFunction& entry, double tol, Block& blk)
+{
+    int m = rows.size(), n = cols.size();
+    int maxRank = std::max(1, (m * n) / (m + n));
+    std::vector<Vector> us, vs;
+    // 已求值的原始行与列 (未减去低秩修正)，rowSlot/colSlot 为其在 sampledRows/sampledCols 中的位置
+    std::vector<Vector> sampledRows, sampledCols;
+    std::vector<int> rowSlot(m, -1), colSlot(n, -1);
+    auto value = [&](int i, int j) -> T {
+        if (rowSlot[i] >= 0) return sampledRows[rowSlot[i]](j);
+        if (colSlot[j] >= 0) return sampledCols[colSlot[j]](i);
+        ++m_evaluated;
+        return entry(m_perm[rows.begin + i], m_perm[cols.begin + j]);
+    };
+    auto sampleRow = [&](int i) -> const Vector& {
+        if (rowSlot[i] < 0) {
+            Vector row(n);
+            for (int j = 0; j < n; ++j) row(j) = value(i, j);
+            rowSlot[i] = (int)sampledRows.size();
+            sampledRows.push_back(row);
+        }
+        return sampledRows[rowSlot[i]];
+    };
+    auto sampleCol = [&](int j) -> const Vector& {
+        if (colSlot[j] < 0) {
+            Vector col(m);
+            for (int i = 0; i < m; ++i) col(i) = value(i, j);
+            colSlot[j] = (int)sampledCols.size();
+            sampledCols.push_back(col);
+        }
+        return sampledCols[colSlot[j]];
+    };
+
+    double norm2 = 0.0;
+    int pivotRow = 0;
+    int negligibleRows = 0;
+    bool converged = false;
+
+    while ((int)us.size() < maxRank) {
+        // 残差行
+        Vector row = sampleRow(pivotRow);
+        for (size_t l = 0; l < us.size(); ++l) row -= us[l](pivotRow) * vs[l];
+
+        int pivotCol = 0;
+        double best = 0.0;
+        for (int j = 0; j < n; ++j) {
+            double a = std::abs(row(j));
+            if (a > best) { best = a; pivotCol = j; }
+        }
+
+        if (best <= tol * m_scale) {
+            // 残差行可忽略: 换下一个未用过的行；连续 kMaxNegligibleRows 行可忽略或全部用过则认为近似已足够
+            int next = -1;
+            for (int i = 0; i < m; ++i) if (rowSlot[i] < 0) { next = i; break; }
+            if (next < 0 || ++negligibleRows >= kMaxNegligibleRows) { converged = true; break; }
+            pivotRow = next;
+            continue;
+        }
+        negligibleRows = 0;
+
+        Vector v = row / row(pivotCol);
+        Vector u = sampleCol(pivotCol);
+        for (size_t l = 0; l < us.size(); ++l) u -= vs[l](pivotCol) * us[l];
+
+        // ‖S_k‖² = ‖S_{k-1}‖² + 2 Re Σ <u_l,u_k><v_l,v_k> + ‖u_k‖²‖v_k‖²
+        double uNorm = u.norm(), vNorm = v.norm();
+        T cross = T(0.0);
+        for (size_t l = 0; l < us.size(); ++l) cross += us[l].dot(u) * vs[l].dot(v);
+        norm2 += 2.0 * std::real(cross) + uNorm * uNorm * vNorm * vNorm;
+        us.push_back(u);
+        vs.push_back(v);
+
+        if (uNorm * vNorm <= tol * std::max(std::sqrt(std::max(norm2, 0.0)), m_scale)) { converged = true; break; }
+
+        // 下一主元行: 当前列残差中模最大的未用行
+        int next = -1;
+        double bestRow = -1.0;
+        for (int i = 0; i < m; ++i) {
+            if (rowSlot[i] >= 0) continue;
+            double a = std::abs(u(i));
+            if (a > bestRow) { bestRow = a; next = i; }
+        }
+        if (next < 0) { converged = true; break; }
+        pivotRow = next;
+    }
+
+    if (!converged) {
+        blk.dense.resize(m, n);
+        for (int i = 0; i < m; ++i) {
+            for (int j = 0; j < n; ++j) blk.dense(i, j) = value(i, j);
+        }
+        return false;
+    }
+
+    int k = (int)us.size();
+    blk.U.resize(m, k);
+    blk.V.resize(n, k);
+    for (int l = 0; l < k; ++l) {
+        blk.U.col(l) = us[l];
+        blk.V.col(l) = vs[l];
+    }
+    return true;
+}
+
+template <typename T>
+typename HMatrix<T>::Matrix HMatrix<T>::toDense() const
+{
+    int n = size();
+    Matrix permuted = Matrix::Zero(n, n);
+    for (const Block& b : m_blocks) {
+        const Cluster& r = m_clusters[b.row];
+        const Cluster& c = m_clusters[b.col];
+        if (b.lowRank) {
+            permuted.block(r.begin, c.begin, r.size(), c.size()) = b.U * b.V.transpose();
+        } else {
+            permuted.block(r.begin, c.begin, r.size(), c.size()) = b.dense;
+        }
+    }
+    Matrix out(n, n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) out(m_perm[i], m_perm[j]) = permuted(i, j);
+    }
+    return out;
+}
+
+template <typename T>
+int HMatrix<T>::lowRankBlocks() const
+{
+    int count = 0;
+    for (const Block& b : m_blocks) if (b.lowRank) ++count;
+    return count;
+}
+
+template <typename T>
+void HMatrix<T>::multiplyPermuted(const Vector& in, Vector& out) const
+{
+    out.setZero(in.size());
+    for (const Block& b : m_blocks) {
+        const Cluster& r = m_clusters[b.row];
+        const Cluster& c = m_clusters[b.col];
+        if (b.lowRank) {
+            Vector t = b.V.transpose() * in.segment(c.begin, c.size());
+            out.segment(r.begin, r.size()) += b.U * t;
+        } else {
+            out.segment(r.begin, r.size()) += b.dense * in.segment(c.begin, c.size());
+        }
+    }
+}
+
+template <typename T>
+void HMatrix<T>::multiply(const Vector& in, Vector& out) const
+{
+    int n = size();
+    Vector xp(n), yp;
+    for (int k = 0; k < n; ++k) xp(k) = in(m_perm[k]);
+    multiplyPermuted(xp, yp);
+    out.resize(n);
+    for (int k = 0; k < n; ++k) out(m_perm[k]) = yp(k);
+}
+
+template <typename T>
+void HMatrix<T>::precondition(Vector& v) const
+{
+    for (int i = 0; i < m_diagBlocks.size(); ++i) {
+        const Cluster& c = m_clusters[m_blocks[m_diagBlocks[i]].row];
+        Vector seg = m_diagLU[i].solve(v.segment(c.begin, c.size()));
+        v.segment(c.begin, c.size()) = seg;
+    }
+}
+
+// GMRES(restart)，右预条件 A M⁻¹ w = b，x = M⁻¹ w；Arnoldi 使用修正 Gram-Schmidt，
+// Hessenberg 矩阵以 Givens 旋转逐列化为上三角，残差范数随迭代直接得到
+template <typename T>
+bool HMatrix<T>::solve(const Vector& b, Vector& x, double tol, int maxIter, int restart) const
+{
+    int n = size();
+    if (b.size() != n) return false;
+    if (x.size() != n) x = Vector::Zero(n);
+
+    // 在聚类顺序下迭代
+    Vector bp(n), xp(n);
+    for (int k = 0; k < n; ++k) { bp(k) = b(m_perm[k]); xp(k) = x(m_perm[k]); }
+    double bNorm = bp.norm();
+    if (bNorm == 0.0) { x.setZero(); return true; }
+
+    restart = std::max(1, std::min(restart, n));
+    std::vector<Vector> basis(restart + 1);
+    Matrix H = Matrix::Zero(restart + 1, restart);
+    Vector g(restart + 1);
+    std::vector<double> cs(restart);
+    std::vector<T> sn(restart);
+
+    Vector r, w, z;
+    multiplyPermuted(xp, w);
+    r = bp - w;
+    double beta = r.norm();
+    int iter = 0;
+    bool converged = beta <= tol * bNorm;
+
+    while (!converged && iter < maxIter) {
+        basis[0] = r / beta;
+        g.setZero();
+        g(0) = beta;
+        H.setZero();
+        int j = 0;
+        for (; j < restart && iter < maxIter; ++j, ++iter) {
+            z = basis[j];
+            precondition(z);
+            multiplyPermuted(z, w);
+            for (int i = 0; i <= j; ++i) {
+                H(i, j) = basis[i].dot(w);
+                w -= H(i, j) * basis[i];
+            }
+            double hNext = w.norm();
+            H(j + 1, j) = hNext;
+            if (hNext > 0.0) basis[j + 1] = w / hNext;
+
+            for (int i = 0; i < j; ++i) {
+                T t = cs[i] * H(i, j) + sn[i] * H(i + 1, j);
+                H(i + 1, j) = -conjugate(sn[i]) * H(i, j) + cs[i] * H(i + 1, j);
+                H(i, j) = t;
+            }
+            T a = H(j, j);
+            double aAbs = std::abs(a), rho = std::sqrt(aAbs * aAbs + hNext * hNext);
+            if (rho == 0.0) { cs[j] = 1.0; sn[j] = T(0.0); }
+            else if (aAbs == 0.0) { cs[j] = 0.0; sn[j] = T(1.0); }
+            else { cs[j] = aAbs / rho; sn[j] = (a / aAbs) * hNext / rho; }
+            H(j, j) = cs[j] * a + sn[j] * H(j + 1, j);
+            H(j + 1, j) = T(0.0);
+            g(j + 1) = -conjugate(sn[j]) * g(j);
+            g(j) = cs[j] * g(j);
+
+            if (std::abs(g(j + 1)) <= tol * bNorm || hNext == 0.0) { ++j; ++iter; break; }
+        }
+
+        // 最小二乘解 y 并更新 x += M⁻¹ V y
+        Vector y = H.topLeftCorner(j, j).template triangularView<Eigen::Upper>().solve(g.head(j));
+        Vector update = Vector::Zero(n);
+        for (int i = 0; i < j; ++i) update += y(i) * basis[i];
+        precondition(update);
+        xp += update;
+
+        multiplyPermuted(xp, w);
+        r = bp - w;
+        beta = r.norm();
+        converged = beta <= tol * bNorm;
+        if (!std::isfinite(beta)) break;
+    }
+
+    for (int k = 0; k < n; ++k) x(m_perm[k]) = xp(k);
+    return converged;
+}
+
+template class HMatrix<double>;
+template class HMatrix<std::complex<double>>;
@@ -0,0 +1,98 @@
+/*
+ * hmatrix.h
+ * 文件作用: 层次低秩矩阵 (H 矩阵) 与迭代求解头文件
+ * 功能描述:
+ * 1. 按裂缝段包围盒建立聚类树 (沿包围盒长边按中心中位数二分)，满足可容许条件
+ *    (两簇包围盒直径的较大者不超过两簇距离的 eta 倍) 的远场块用自适应交叉近似 (ACA，部分选主元)
+ *    压缩为低秩 U·Vᵀ，其余近场块稠密存储。
+ * 2. 矩阵元素由回调按需生成，远场块只计算 ACA 选中的行与列，求值量由 m·n 降为约 k·(m+n)；
+ *    ACA 达到秩上限仍未收敛的远场块改存稠密块时沿用已求值的行与列，每个元素至多求值一次。
+ * 3. 提供矩阵-向量乘与 GMRES(restart) 迭代求解 (对角叶块 LU 作块对角预条件)。
+ * 4. 标量类型为 double 或 std::complex<double> (两者在实现文件中显式实例化)。
+ */
+
+#ifndef HMATRIX_H
+#define HMATRIX_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <Eigen/Dense>
+#include <complex>
+#include <functional>
+
+template <typename T>
+class HMatrix
+{
+public:
+    using Matrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+    using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+    // 原始下标 (row, col) 处的矩阵元素
+    using EntryFunction = std::function<T(int row, int col)>;
+
+    struct Options {
+        int leafSize = 16;            // 叶簇最多包含的点数
+        double eta = 1.0;             // 可容许条件参数
+        double acaTolerance = 1e-10;  // ACA 截断的相对误差 (相对于块 Frobenius 范数估计与近场元素量级中的较大者)
+    };
+
+    HMatrix() {}
+
+    // 建立 H 矩阵: 第 i 个点 (同时对应第 i 行与第 i 列) 的包围盒为 [x_i - r_i, x_i + r_i] × {y_i}
+    void build(const QVector<double>& x, const QVector<double>& y, const QVector<double>& radius,
+               const EntryFunction& entry, const Options& options);
+    void build(const QVector<double>& x, const QVector<double>& y, const QVector<double>& radius,
+               const EntryFunction& entry) { build(x, y, radius, entry, Options()); }
+
+    int size() const { return m_perm.size(); }
+
+    // out = A * in (原始下标顺序)
+    void multiply(const Vector& in, Vector& out) const;
+
+    // 展开为稠密矩阵 (原始下标顺序，低秩块按 U·Vᵀ 展开，不再求值矩阵元素)
+    Matrix toDense() const;
+
+    // GMRES(restart) 求解 A x = b (右预条件)，x 的初值作为迭代起点；相对残差不超过 tol 时返回 true
+    bool solve(const Vector& b, Vector& x, double tol, int maxIter = 300, int restart = 50) const;
+
+    // 统计: 实际计算的矩阵元素个数、低秩块与稠密块个数
+    qint64 evaluatedEntries() const { return m_evaluated; }
+    int lowRankBlocks() const;
+    int denseBlocks() const { return m_blocks.size() - lowRankBlocks(); }
+
+private:
+    struct Cluster {
+        int begin = 0, end = 0;  // 聚类顺序下标区间 [begin, end)
+        double xmin = 0.0, xmax = 0.0, ymin = 0.0, ymax = 0.0;
+        int child[2] = { -1, -1 };
+        bool isLeaf() const { return child[0] < 0; }
+        int size() const { return end - begin; }
+    };
+
+    // 低秩块 A ≈ U·Vᵀ (U 为 m×k，V 为 n×k)，稠密块存于 dense
+    struct Block {
+        int row = 0, col = 0;  // 行簇与列簇
+        bool admissible = false;
+        bool lowRank = false;
+        Matrix dense;
+        Matrix U, V;
+    };
+
+    int buildCluster(const QVector<double>& x, const QVector<double>& y, const QVector<double>& radius,
+                     int begin, int end, int leafSize);
+    void buildBlocks(int a, int b, double eta);
+    bool aca(const Cluster& rows, const Cluster& cols, const EntryFunction& entry, double tol, Block& blk);
+    void fillDense(const Cluster& rows, const Cluster& cols, const EntryFunction& entry, Matrix& out);
+    // 聚类顺序下的矩阵-向量乘与块对角预条件
+    void multiplyPermuted(const Vector& in, Vector& out) const;
+    void precondition(Vector& v) const;
+
+    QVector<int> m_perm;        // 聚类顺序下标 -> 原始下标
+    QVector<Cluster> m_clusters;
+    QVector<Block> m_blocks;
+    QVector<int> m_diagBlocks;  // 对角叶块在 m_blocks 中的位置
+    QVector<Eigen::PartialPivLU<Matrix>> m_diagLU;
+    qint64 m_evaluated = 0;
+    double m_scale = 0.0;       // 近场块元素模的最大值，作为 ACA 截断的绝对量级
+};
+
+#endif // HMATRIX_H
@@ -0,0 +1,190 @@
+/*
+ * laplaceinversion.h
+ * 文件作用: 数值拉普拉斯反演引擎头文件
+ * 功能描述:
+ * 1. 定义反演方法枚举 (Stehfest、固定 Talbot、de Hoog、Euler) 与统一的反演引擎接口。
+ * 2. Stehfest、Talbot、Euler 属于 Abate-Whitt 统一框架: f(t) ≈ (1/t) Σ Re[ω_k F(α_k/t)]，
+ *    de Hoog 在 Fourier 级数上用 QD 连分式加速。
+ * 3. 每个时间点同时给出 f(t) 与 t·f'(t) (由 s·F(s) 反演)，两者共用同一组拉普拉斯求值。
+ */
+
+#ifndef LAPLACEINVERSION_H
+#define LAPLACEINVERSION_H
+
+#include <QString>
+#include <QVector>
+#include <QSharedPointer>
+#include <cmath>
+#include <complex>
+#include <functional>
+
+// 双倍双精度数 hi + lo (约 32 位有效数字)，用于 Stehfest 系数与交错求和的补偿计算；
+// 不依赖 long double (MSVC 中 long double 与 double 相同)。乘法的误差项由 std::fma 精确给出
+struct DoubleDouble {
+    double hi = 0.0;
+    double lo = 0.0;
+
+    DoubleDouble() {}
+    DoubleDouble(double h, double l = 0.0) : hi(h), lo(l) {}
+
+    double value() const { return hi + lo; }
+
+    // a + b 的精确和 (Knuth TwoSum)
+    static DoubleDouble twoSum(double a, double b)
+    {
+        double s = a + b;
+        double bb = s - a;
+        return DoubleDouble(s, (a - (s - bb)) + (b - bb));
+    }
+    // a * b 的精确积
+    static DoubleDouble twoProd(double a, double b)
+    {
+        double p = a * b;
+        return DoubleDouble(p, std::fma(a, b, -p));
+    }
+    static DoubleDouble normalize(double h, double l)
+    {
+        double s = h + l;
+        return DoubleDouble(s, l - (s - h));
+    }
+
+    DoubleDouble operator+(const DoubleDouble& o) const
+    {
+        DoubleDouble s = twoSum(hi, o.hi);
+        return normalize(s.hi, s.lo + lo + o.lo);
+    }
+    DoubleDouble& operator+=(const DoubleDouble& o) { return *this = *this + o; }
+    DoubleDouble operator*(double b) const
+    {
+        DoubleDouble p = twoProd(hi, b);
+        return normalize(p.hi, p.lo + lo * b);
+    }
+    DoubleDouble operator*(const DoubleDouble& o) const
+    {
+        DoubleDouble p = twoProd(hi, o.hi);
+        return normalize(p.hi, p.lo + hi * o.lo + lo * o.hi);
+    }
+    DoubleDouble operator/(const DoubleDouble& o) const
+    {
+        // 商的首项与一次修正: q1 = hi/o.hi，余数 r = this - q1·o
+        double q1 = hi / o.hi;
+        DoubleDouble r = *this + (o * -q1);
+        return normalize(q1, r.hi / o.hi);
+    }
+    DoubleDouble operator-() const { return DoubleDouble(-hi, -lo); }
+};
+
+// 反演方法
+enum class InversionMethod {
+    Stehfest = 0, // 实轴 Gaver-Stehfest
+    Talbot,       // 固定 Talbot 围道 (Abate-Valkó)
+    DeHoog,       // de Hoog-Knight-Stokes QD 算法
+    Euler         // Euler 级数加速 (Abate-Whitt)
+};
+
+class InversionEngine
+{
+public:
+    using Complex = std::complex<double>;
+    using LaplaceFunction = std::function<Complex(Complex)>;
+
+    virtual ~InversionEngine() {}
+
+    virtual InversionMethod method() const = 0;
+
+    // 阶数 (各方法含义不同: Stehfest 为 N，Talbot 为节点数 M，de Hoog/Euler 为级数项数 M)
+    virtual int order() const = 0;
+
+    // 每个时间点需要的拉普拉斯函数求值次数
+    virtual int evaluationsPerPoint() const = 0;
+
+    // 反演单个时间点: f = f(t)，tdf = t·df/dt (假定 f(0) = 0)
+    virtual void invert(const LaplaceFunction& F, double t, double& f, double& tdf) const = 0;
+
+    // 创建引擎，order <= 0 时使用该方法的默认阶数
+    static QSharedPointer<InversionEngine> create(InversionMethod method, int order = 0);
+
+    // 各方法的默认阶数 (highPrecision 为 false 时给出较低的快速阶数)
+    static int defaultOrder(InversionMethod method, bool highPrecision = true);
+
+    // 方法名称
+    static QString methodName(InversionMethod method);
+};
+
+// Abate-Whitt 统一框架下的线性反演: f(t) ≈ (1/t) Σ Re[ω_k F(α_k/t)]
+class LinearInversionEngine : public InversionEngine
+{
+public:
+    int evaluationsPerPoint() const override { return m_alpha.size(); }
+    void invert(const LaplaceFunction& F, double t, double& f, double& tdf) const override;
+
+protected:
+    QVector<Complex> m_alpha; // 节点 α_k
+    QVector<Complex> m_omega; // 权重 ω_k
+};
+
+// Gaver-Stehfest
+class StehfestInversion : public LinearInversionEngine
+{
+public:
+    explicit StehfestInversion(int N);
+    InversionMethod method() const override { return InversionMethod::Stehfest; }
+    int order() const override { return m_N; }
+
+    // 支持的最高阶数 (更高阶时 V_i 的量级超过 1e15，双精度的 p(z) 已无法支撑)
+    static const int kMaxOrder = 30;
+
+    // Stehfest 系数 V_i (i = 1..N)
+    static double coefficient(int i, int N);
+
+    // 阶数 N 的系数表 V[1..N] (V[0] 不使用)，以双倍双精度计算与保存 (高阶系数的量级超过 1e15，
+    // 取整到 double 的误差会被交错求和放大)，首次使用时为所有偶数阶一次性缓存；N 非法时返回空表
+    static const QVector<DoubleDouble>& weights(int N);
+
+private:
+    int m_N;
+};
+
+// 固定 Talbot 围道 (Abate & Valkó, 2004)
+class TalbotInversion : public LinearInversionEngine
+{
+public:
+    explicit TalbotInversion(int M);
+    InversionMethod method() const override { return InversionMethod::Talbot; }
+    int order() const override { return m_M; }
+
+private:
+    int m_M;
+};
+
+// Euler 级数加速 (Abate & Whitt, 2006)，共 2M+1 个节点
+class EulerInversion : public LinearInversionEngine
+{
+public:
+    explicit EulerInversion(int M);
+    InversionMethod method() const override { return InversionMethod::Euler; }
+    int order() const override { return m_M; }
+
+private:
+    int m_M;
+};
+
+// de Hoog-Knight-Stokes (1982)，每个时间点取周期 T = 2t，共 2M+1 个节点
+class DeHoogInversion : public InversionEngine
+{
+public:
+    explicit DeHoogInversion(int M, double tolerance = 1e-12);
+    InversionMethod method() const override { return InversionMethod::DeHoog; }
+    int order() const override { return m_M; }
+    int evaluationsPerPoint() const override { return 2 * m_M + 1; }
+    void invert(const LaplaceFunction& F, double t, double& f, double& tdf) const override;
+
+private:
+    // 对 Fourier 系数 a[0..2M] 做 QD 连分式求和，返回 Re 部分
+    double accelerate(const QVector<Complex>& a, Complex zt) const;
+
+    int m_M;
+    double m_tolerance;
+};
+
+#endif // LAPLACEINVERSION_H
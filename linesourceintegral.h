@@ -0,0 +1,37 @@
+/*
+ * linesourceintegral.h
+ * 文件作用: 线源 Bessel 积分解析计算模块头文件
+ * 功能描述:
+ * 1. 提供 ∫K0(t)dt (Bickley-Naylor Ki1 函数) 与缩放 ∫I0(t)dt 的快速计算。
+ * 2. 提供均匀流量线源沿裂缝段积分 ∫K0(γ|x-a|)da 的闭式表达，替代逐点自适应积分。
+ * 3. 纯数学工具，不依赖任何 UI 控件，所有函数均为静态且线程安全。
+ */
+
+#ifndef LINESOURCEINTEGRAL_H
+#define LINESOURCEINTEGRAL_H
+
+class LineSourceIntegral
+{
+public:
+    // ∫_0^x K0(t) dt, x >= 0
+    static double integralK0(double x);
+
+    // Bickley-Naylor 函数 Ki1(x) = ∫_x^∞ K0(t) dt = π/2 - ∫_0^x K0(t) dt
+    static double bickleyKi1(double x);
+
+    // 缩放积分 e^{-x} * ∫_0^x I0(t) dt, x >= 0 (防止大参数溢出)
+    static double integralI0Scaled(double x);
+
+    // 线段积分 ∫_{u1}^{u2} K0(γ|u|) du
+    static double segmentK0(double gamma, double u1, double u2);
+
+    // 线段积分 ∫_{u1}^{u2} I0(γ|u|) * e^{-shift} du，shift 用于与外部指数因子合并以免溢出
+    static double segmentI0Scaled(double gamma, double u1, double u2, double shift);
+
+private:
+    // 带符号的原函数 (奇延拓)
+    static double signedIntegralK0(double v);
+    static double signedIntegralI0(double v, double shift);
+};
+
+#endif // LINESOURCEINTEGRAL_H
@@ -0,0 +1,42 @@
+/*
+ * logloginterpolator.h
+ * 文件作用: 双对数坐标单调三次插值工具头文件
+ * 功能描述:
+ * 1. 在 (ln x, ln y) 坐标下做分段三次 Hermite 插值，斜率按 Fritsch-Carlson 条件限幅 (单调三次/PCHIP)，
+ *    不产生过冲，保持试井压力/导数曲线的单调性。
+ * 2. y 中存在非正值时自动改为 (ln x, y) 坐标插值。
+ * 3. 供典型曲线缓存与粗网格求解结果映射到实测时间点使用，纯数学工具，不依赖 UI 控件。
+ */
+
+#ifndef LOGLOGINTERPOLATOR_H
+#define LOGLOGINTERPOLATOR_H
+
+#include <QVector>
+
+class LogLogInterpolator
+{
+public:
+    LogLogInterpolator() {}
+
+    // 由节点 (x_i, y_i) 构建插值，x 必须为正且严格递增，节点数不少于 2；失败时返回 false
+    bool build(const QVector<double>& x, const QVector<double>& y);
+
+    // 求值；超出节点范围时按端点区间的三次多项式外推
+    double eval(double x) const;
+
+    // 批量求值
+    void eval(const QVector<double>& x, QVector<double>& y) const;
+
+    bool isValid() const { return m_u.size() >= 2; }
+    int size() const { return m_u.size(); }
+    double xMin() const;
+    double xMax() const;
+
+private:
+    QVector<double> m_u;     // ln x
+    QVector<double> m_v;     // ln y 或 y
+    QVector<double> m_slope; // dv/du
+    bool m_logY = true;
+};
+
+#endif // LOGLOGINTERPOLATOR_H
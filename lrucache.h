@@ -0,0 +1,115 @@
+/*
+ * lrucache.h
+ * 文件作用: 按最近使用顺序淘汰的共享只读缓存模板
+ * 功能描述:
+ * 1. LruCache<V> 以字节串键 (参数的原始二进制) 索引 V 的共享只读指针，只有键完全相同才会命中。
+ * 2. 条目以共享只读指针返回，替换或淘汰条目不影响正在使用它的调用方；线程安全，超出容量时淘汰最久未使用的条目。
+ * 3. 典型曲线缓存与储层响应缓存由此派生，各自提供全局共享实例与默认容量。
+ */
+
+#ifndef LRUCACHE_H
+#define LRUCACHE_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSharedPointer>
+
+template <typename V>
+class LruCache
+{
+public:
+    // 查找条目，未命中返回空指针
+    QSharedPointer<const V> find(const QByteArray& key)
+    {
+        QMutexLocker locker(&m_mutex);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            ++m_misses;
+            return QSharedPointer<const V>();
+        }
+        ++m_hits;
+        it->lastUse = ++m_clock;
+        return it->value;
+    }
+
+    // 插入或替换条目，超出容量时淘汰最久未使用的条目
+    void insert(const QByteArray& key, const QSharedPointer<const V>& value)
+    {
+        QMutexLocker locker(&m_mutex);
+        Entry& e = m_entries[key];
+        e.value = value;
+        e.lastUse = ++m_clock;
+        evictLocked();
+    }
+
+    void clear()
+    {
+        QMutexLocker locker(&m_mutex);
+        m_entries.clear();
+    }
+
+    int size() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_entries.size();
+    }
+
+    // 最多缓存的条目数
+    void setCapacity(int capacity)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_capacity = qMax(1, capacity);
+        evictLocked();
+    }
+
+    int capacity() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_capacity;
+    }
+
+    // 命中与未命中次数 (用于评估缓存效果)
+    quint64 hits() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_hits;
+    }
+
+    quint64 misses() const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_misses;
+    }
+
+protected:
+    explicit LruCache(int capacity) : m_capacity(capacity) {}
+
+private:
+    struct Entry {
+        QSharedPointer<const V> value;
+        quint64 lastUse = 0;
+    };
+
+    // 淘汰最久未使用的条目直到不超过容量 (调用方已持有锁)
+    void evictLocked()
+    {
+        while (m_entries.size() > m_capacity) {
+            auto oldest = m_entries.begin();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+                if (it->lastUse < oldest->lastUse) oldest = it;
+            }
+            m_entries.erase(oldest);
+        }
+    }
+
+    mutable QMutex m_mutex;
+    QHash<QByteArray, Entry> m_entries;
+    quint64 m_clock = 0;
+    quint64 m_hits = 0;
+    quint64 m_misses = 0;
+    int m_capacity;
+};
+
+#endif // LRUCACHE_H
@@ -189,6 +189,7 @@ void MainWindow::init()
     ui->verticalLayout_3->addWidget(m_SettingsWidget);
     connect(m_SettingsWidget, &SettingsWidget::settingsChanged,
             this, &MainWindow::onSystemSettingsChanged);
+    onSystemSettingsChanged(); // 按已保存的设置初始化模型页精度档位与求解线程数
 
     initProjectForm();
     initDataEditorForm();
@@ -411,6 +412,10 @@ void MainWindow::onFittingProgressChanged(int progress)
 void MainWindow::onSystemSettingsChanged()
 {
     qDebug() << "系统设置已变更";
+    if (m_ModelManager && m_SettingsWidget) {
+        m_ModelManager->setAccuracyProfile((AccuracyProfile)m_SettingsWidget->getModelAccuracyProfile());
+        ModelManager::setSolverThreadCount(m_SettingsWidget->getSolverThreadCount());
+    }
 }
 
 void MainWindow::onPerformanceSettingsChanged() {}
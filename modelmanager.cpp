@@ -12,6 +12,7 @@
 #include "modelparameter.h"
 #include "wt_modelwidget.h"
 #include "modelsolver01-06.h"
+#include "fitengine.h"
 
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -132,17 +133,18 @@ void ModelManager::onWidgetCalculationCompleted(const QString &t, const QMap<QSt
     emit calculationCompleted(t, r);
 }
 
-void ModelManager::setHighPrecision(bool high) {
-    // 1. 设置界面里的求解器精度
+void ModelManager::setAccuracyProfile(AccuracyProfile profile) {
     for(WT_ModelWidget* w : m_modelWidgets) {
-        w->setHighPrecision(high);
-    }
-    // 2. 设置后台求解器精度 (关键：拟合时使用的是这里的求解器)
-    for(ModelSolver01_06* s : m_solvers) {
-        s->setHighPrecision(high);
+        w->setAccuracyProfile(profile);
     }
 }
 
+void ModelManager::setSolverThreadCount(int count)
+{
+    ModelSolver01_06::setMaxThreadCount(count);
+    FitEngine::setMaxThreadCount(count);
+}
+
 void ModelManager::updateAllModelsBasicParameters()
 {
     for(WT_ModelWidget* w : m_modelWidgets) {
@@ -191,16 +193,37 @@ QMap<QString, double> ModelManager::getDefaultParameters(ModelType type)
 }
 
 // [核心修改] 使用独立的 Solver 进行计算，不再调用 Widget 方法
-ModelCurveData ModelManager::calculateTheoreticalCurve(ModelType type, const QMap<QString, double>& params, const QVector<double>& providedTime)
+ModelCurveData ModelManager::calculateTheoreticalCurve(ModelType type, const QMap<QString, double>& params, const QVector<double>& providedTime,
+                                                       const SolverOptions& options)
 {
     int index = (int)type;
     // 使用 m_solvers 而不是 m_modelWidgets
     if (index >= 0 && index < m_solvers.size()) {
-        return m_solvers[index]->calculateTheoreticalCurve(params, providedTime);
+        return m_solvers[index]->calculateTheoreticalCurve(params, providedTime, options);
     }
     return ModelCurveData();
 }
 
+ModelCurveData ModelManager::calculateTheoreticalCurve(ModelType type, const ModelParams& params, const QVector<double>& providedTime,
+                                                       const SolverOptions& options)
+{
+    int index = (int)type;
+    if (index >= 0 && index < m_solvers.size()) {
+        return m_solvers[index]->calculateTheoreticalCurve(params, providedTime, options);
+    }
+    return ModelCurveData();
+}
+
+QVector<ModelCurveData> ModelManager::calculateTheoreticalCurves(ModelType type, const QVector<ModelParams>& paramSets, const QVector<double>& providedTime,
+                                                                const SolverOptions& options)
+{
+    int index = (int)type;
+    if (index >= 0 && index < m_solvers.size()) {
+        return m_solvers[index]->calculateTheoreticalCurves(paramSets, providedTime, options);
+    }
+    return QVector<ModelCurveData>(paramSets.size());
+}
+
 QVector<double> ModelManager::generateLogTimeSteps(int count, double startExp, double endExp) {
     // 委托给 Solver 的静态方法
     return ModelSolver01_06::generateLogTimeSteps(count, startExp, endExp);
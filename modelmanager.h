@@ -46,14 +46,25 @@ public:
     // 获取模型名称描述
     static QString getModelTypeName(ModelType type);
 
-    // 核心计算接口：代理给对应的 Solver 进行计算 (线程安全，可在拟合线程调用)
-    ModelCurveData calculateTheoreticalCurve(ModelType type, const QMap<QString, double>& params, const QVector<double>& providedTime = QVector<double>());
+    // 核心计算接口：代理给对应的 Solver 进行计算 (线程安全，可在拟合线程调用；精度等选项按调用传入，互不影响)
+    ModelCurveData calculateTheoreticalCurve(ModelType type, const QMap<QString, double>& params, const QVector<double>& providedTime = QVector<double>(),
+                                             const SolverOptions& options = SolverOptions());
+    // 同上，使用已转换的参数块 (拟合迭代中使用)
+    ModelCurveData calculateTheoreticalCurve(ModelType type, const ModelParams& params, const QVector<double>& providedTime = QVector<double>(),
+                                             const SolverOptions& options = SolverOptions());
+
+    // 批量计算接口: 同一时间序列上一次计算多组参数的理论曲线 (敏感性分析、批量拟合等)，结果与参数组一一对应
+    QVector<ModelCurveData> calculateTheoreticalCurves(ModelType type, const QVector<ModelParams>& paramSets, const QVector<double>& providedTime = QVector<double>(),
+                                                       const SolverOptions& options = SolverOptions());
 
     // 获取默认参数
     QMap<QString, double> getDefaultParameters(ModelType type);
 
-    // 设置全局计算精度
-    void setHighPrecision(bool high);
+    // 设置各模型界面的精度档位 (仅影响界面计算，后台求解器的精度由每次调用的 SolverOptions 决定)
+    void setAccuracyProfile(AccuracyProfile profile);
+
+    // 设置求解并行的最大线程数 (<=0 表示使用 CPU 核心数)，同时用于时间点并行与拟合的雅可比扰动求解
+    static void setSolverThreadCount(int count);
 
     // 刷新所有界面模型的参数显示
     void updateAllModelsBasicParameters();
@@ -4,6 +4,7 @@
  * 功能描述:
  * 1. 实现项目数据的加载与保存。
  * 2. [关键] loadProject 时强制读取 _date.json 到 m_fullProjectData["table_data"]，解决数据丢失问题。
+ * 3. 裂缝几何保存在主文件的 "fracture_geometry" 字段中。
  */
 
 #include "modelparameter.h"
@@ -205,6 +206,29 @@ QJsonObject ModelParameter::getFittingResult() const
     return m_fullProjectData.value("fitting").toObject();
 }
 
+void ModelParameter::saveFractureGeometry(const FractureGeometry& geometry)
+{
+    if (m_projectFilePath.isEmpty()) return;
+    if (geometry.isEmpty()) m_fullProjectData.remove("fracture_geometry");
+    else m_fullProjectData["fracture_geometry"] = geometry.toJson();
+
+    QFile file(m_projectFilePath);
+    if (file.open(QIODevice::WriteOnly)) {
+        QJsonObject dataToWrite = m_fullProjectData;
+        dataToWrite.remove("plotting_data");
+        dataToWrite.remove("table_data");
+        file.write(QJsonDocument(dataToWrite).toJson());
+        file.close();
+    }
+}
+
+QSharedPointer<const FractureGeometry> ModelParameter::getFractureGeometry() const
+{
+    FractureGeometry geometry = FractureGeometry::fromJson(m_fullProjectData.value("fracture_geometry").toObject());
+    if (geometry.isEmpty()) return QSharedPointer<const FractureGeometry>();
+    return QSharedPointer<const FractureGeometry>(new FractureGeometry(geometry));
+}
+
 void ModelParameter::savePlottingData(const QJsonArray& plots)
 {
     if (m_projectFilePath.isEmpty()) return;
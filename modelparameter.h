@@ -16,6 +16,8 @@
 #include <QJsonDocument>
 #include <QJsonArray>
 #include <QMutex>
+#include <QSharedPointer>
+#include "fracturegeometry.h"
 
 class ModelParameter : public QObject
 {
@@ -60,6 +62,11 @@ public:
     void saveFittingResult(const QJsonObject& fittingData);
     QJsonObject getFittingResult() const;
 
+    // 裂缝几何 (任意完井布置)，由模型参数页的裂缝几何对话框编辑，随 .pwt 主文件保存；
+    // 未设置时返回空指针，求解器使用模型参数 nf 的等间距布置
+    void saveFractureGeometry(const FractureGeometry& geometry);
+    QSharedPointer<const FractureGeometry> getFractureGeometry() const;
+
     // ========================================================================
     // 独立数据文件存取 (关键修复部分)
     // ========================================================================
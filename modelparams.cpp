@@ -0,0 +1,83 @@
+/*
+ * modelparams.cpp
+ * 文件作用: 求解器参数块实现
+ * 功能描述:
+ * 1. 维护参数名与槽位的对应表及缺省值。
+ * 2. 实现 ModelParams 与 QMap<QString,double> 的相互转换。
+ */
+
+#include "modelparams.h"
+
+namespace {
+
+struct SlotInfo {
+    const char* name;
+    double defaultValue;
+};
+
+// 顺序必须与 ModelParams::Slot 一致
+const SlotInfo kSlotInfo[ModelParams::SlotCount] = {
+    { "phi",     0.05 },
+    { "h",       20.0 },
+    { "mu",      0.5 },
+    { "B",       1.05 },
+    { "Ct",      5e-4 },
+    { "q",       5.0 },
+    { "kf",      1e-3 },
+    { "km",      0.0 },
+    { "L",       1000.0 },
+    { "Lf",      0.0 },
+    { "LfD",     0.0 },
+    { "rmD",     0.0 },
+    { "reD",     0.0 },
+    { "omega1",  0.0 },
+    { "omega2",  0.0 },
+    { "lambda1", 0.0 },
+    { "nf",      4.0 },
+    { "cD",      0.0 },
+    { "S",       0.0 },
+    { "gamaD",   0.0 },
+    { "N",       4.0 }
+};
+
+} // namespace
+
+ModelParams::ModelParams()
+{
+    for (int i = 0; i < SlotCount; ++i) v[i] = kSlotInfo[i].defaultValue;
+}
+
+ModelParams ModelParams::fromMap(const QMap<QString, double>& map)
+{
+    ModelParams p;
+    for (auto it = map.constBegin(); it != map.constEnd(); ++it) {
+        int slot = slotOf(it.key());
+        if (slot >= 0) p.v[slot] = it.value();
+    }
+    return p;
+}
+
+QMap<QString, double> ModelParams::toMap() const
+{
+    QMap<QString, double> map;
+    for (int i = 0; i < SlotCount; ++i) map.insert(kSlotInfo[i].name, v[i]);
+    return map;
+}
+
+int ModelParams::slotOf(const QString& name)
+{
+    for (int i = 0; i < SlotCount; ++i) {
+        if (name == QLatin1String(kSlotInfo[i].name)) return i;
+    }
+    return -1;
+}
+
+QString ModelParams::slotName(Slot s)
+{
+    return QString::fromLatin1(kSlotInfo[s].name);
+}
+
+void ModelParams::updateDependents()
+{
+    if (v[L] > 1e-9 && v[Lf] > 0.0) v[LfD] = v[Lf] / v[L];
+}
@@ -0,0 +1,74 @@
+/*
+ * modelparams.h
+ * 文件作用: 求解器参数块定义头文件
+ * 功能描述:
+ * 1. 定义固定槽位的模型参数结构体 ModelParams，替代求解器热点路径中的 QMap<QString,double>。
+ * 2. 提供与界面/JSON 使用的 QMap 之间的一次性相互转换。
+ * 3. 提供参数名到槽位的映射，供拟合算法按槽位直接扰动参数。
+ */
+
+#ifndef MODELPARAMS_H
+#define MODELPARAMS_H
+
+#include <QMap>
+#include <QString>
+#include <QSharedPointer>
+#include "fracturegeometry.h"
+
+struct ModelParams
+{
+    // 参数槽位
+    enum Slot {
+        Phi = 0,  // 孔隙度
+        H,        // 有效厚度
+        Mu,       // 粘度
+        B,        // 体积系数
+        Ct,       // 综合压缩系数
+        Q,        // 产量
+        Kf,       // 内区渗透率
+        Km,       // 外区渗透率
+        L,        // 水平井长度
+        Lf,       // 裂缝半长
+        LfD,      // 无因次裂缝半长
+        RmD,      // 无因次复合半径
+        ReD,      // 无因次外边界半径
+        Omega1,   // 储容比 1
+        Omega2,   // 储容比 2
+        Lambda1,  // 窜流系数
+        Nf,       // 裂缝条数
+        CD,       // 无因次井储系数
+        S,        // 表皮系数
+        GamaD,    // 压敏系数
+        N,        // Stehfest 反演阶数
+        SlotCount
+    };
+
+    double v[SlotCount];
+
+    // 裂缝几何 (可选): 非空时求解器按其中的裂缝段计算，nf 与 LfD 不再使用；不参与 QMap 转换
+    QSharedPointer<const FractureGeometry> geometry;
+
+    // 影响系数数值积分设置: 由求解器按 SolverOptions 写入后随参数块传给核函数；不参与 QMap 转换
+    double quadratureTolerance = 1e-5;
+    int quadratureMaxDepth = 10;
+
+    // 默认值与原 QMap::value 读取时的缺省值一致
+    ModelParams();
+
+    double& operator[](Slot s) { return v[s]; }
+    double operator[](Slot s) const { return v[s]; }
+
+    // 由界面/JSON 参数字典转换 (未知键忽略，缺失键取缺省值)
+    static ModelParams fromMap(const QMap<QString, double>& map);
+    // 转换回参数字典 (用于界面显示与信号传递)
+    QMap<QString, double> toMap() const;
+
+    // 参数名对应的槽位，未知参数返回 -1
+    static int slotOf(const QString& name);
+    static QString slotName(Slot s);
+
+    // 更新依赖参数: LfD = Lf / L
+    void updateDependents();
+};
+
+#endif // MODELPARAMS_H
@@ -8,22 +8,108 @@
  */
 
 #include "modelsolver01-06.h"
-#include "pressurederivativecalculator.h" // 假设此文件为通用算法库，若未包含可将导数计算逻辑移入此处
+#include "linesourceintegral.h"
+#include "besselbatch.h"
+#include "complexbessel.h"
+#include "typecurvecache.h"
+#include "reservoirresponsecache.h"
+#include "solverworkspace.h"
+#include "hmatrix.h"
+#include "logloginterpolator.h"
 
 #include <Eigen/Dense>
-#include <boost/math/special_functions/bessel.hpp>
 #include <cmath>
 #include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <type_traits>
 #include <QDebug>
+#include <QMutexLocker>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+// 标记当前线程是否为求解器线程池中的工作线程 (或处于 SerialScope 内)，此时 runParallel 串行执行
+static thread_local bool t_inSolverWorker = false;
+
+namespace {
+
+using Complex = std::complex<double>;
+
+// 实数/复数参数的 Bessel 函数与线源积分 (供按标量类型模板化的核函数调用)
+inline void besselValues(const double* x, int n, double* k0, double* k1, double* i0e, double* i1e) {
+    SOLVER_STATS_ADD(besselCalls, n);
+    BesselBatch::evaluate(x, n, k0, k1, i0e, i1e);
+}
+inline void besselValues(const Complex* x, int n, Complex* k0, Complex* k1, Complex* i0e, Complex* i1e) {
+    SOLVER_STATS_ADD(besselCalls, n);
+    for (int i = 0; i < n; ++i) ComplexBessel::evaluate(x[i], k0[i], k1[i], i0e[i], i1e[i]);
+}
+inline double segmentK0(double gamma, double u1, double u2) {
+    return LineSourceIntegral::segmentK0(gamma, u1, u2);
+}
+inline Complex segmentK0(Complex gamma, double u1, double u2) {
+    return ComplexBessel::segmentK0(gamma, u1, u2);
+}
+inline double segmentI0Scaled(double gamma, double u1, double u2, double shift) {
+    return LineSourceIntegral::segmentI0Scaled(gamma, u1, u2, shift);
+}
+inline Complex segmentI0Scaled(Complex gamma, double u1, double u2, Complex shift) {
+    return ComplexBessel::segmentI0Scaled(gamma, u1, u2, shift);
+}
+
+// 15 点 Gauss-Legendre 节点 (对称半边) 与权重
+const double kGaussX[] = { 0.0, 0.201194, 0.394151, 0.570972, 0.724418, 0.848207, 0.937299, 0.987993 };
+const double kGaussW[] = { 0.202578, 0.198431, 0.186161, 0.166269, 0.139571, 0.107159, 0.070366, 0.030753 };
+
+// 生成 [a,b] 上的 15 个积分节点
+void gaussNodes(double a, double b, double* out) {
+    double h = 0.5 * (b - a); double c = 0.5 * (a + b);
+    out[0] = c;
+    for (int i = 1; i < 8; ++i) { out[2 * i - 1] = c - h * kGaussX[i]; out[2 * i] = c + h * kGaussX[i]; }
+}
+
+template <typename T>
+T gaussSum(const T* f, double a, double b) {
+    T s = kGaussW[0] * f[0];
+    for (int i = 1; i < 8; ++i) s += kGaussW[i] * (f[2 * i - 1] + f[2 * i]);
+    return s * (0.5 * (b - a));
+}
+
+// 双对数幂律渐近式: 导数 d = dA·(t/tA)^n，压力 p = pA + dA·((t/tA)^n - 1)/n (n→0 时为 pA + dA·ln(t/tA))。
+// 井储 (n=1)、双线性流 (1/4)、线性流 (1/2)、拟径向流 (0) 与拟稳态 (1) 段均为此形式
+struct PowerLawAsymptote {
+    double tA = 0.0, pA = 0.0, dA = 0.0, n = 0.0;
+
+    // 由锚点 (tA, pA, dA) 与另一点的导数确定指数，两点导数须同号且非零
+    bool fit(double t0, double p0, double d0, double t1, double d1) {
+        if (!(d0 * d1 > 0.0) || t0 == t1) return false;
+        tA = t0; pA = p0; dA = d0;
+        n = std::log(d1 / d0) / std::log(t1 / t0);
+        return std::isfinite(n);
+    }
+    void eval(double t, double& p, double& d) const {
+        double r = std::log(t / tA);
+        double nr = n * r;
+        d = dA * std::exp(nr);
+        p = pA + dA * ((std::abs(nr) > 1e-12) ? std::expm1(nr) / n : r);
+    }
+};
+
+}
+
 // 构造函数
 ModelSolver01_06::ModelSolver01_06(ModelType type)
     : m_type(type)
-    , m_highPrecision(true)
+    , m_kernel(kernelFor(type))
+    , m_complexKernel(complexKernelFor(type))
+    , m_reservoirKernel(reservoirKernelFor(type))
+    , m_complexReservoirKernel(complexReservoirKernelFor(type))
+    , m_hasStorage(type == Model_1 || type == Model_3 || type == Model_5)
 {
 }
 
@@ -32,10 +118,94 @@ ModelSolver01_06::~ModelSolver01_06()
 {
 }
 
-// 设置精度
-void ModelSolver01_06::setHighPrecision(bool high)
+// 一次计算中某组储层参数的储层响应查表: 先查缓存快照 (只读，无需加锁)，未命中时计算并记入本线程的新增值表
+// (各线程各自一张，求值路径不加锁)；计算结束后各线程的新增值与快照合并为新条目写回缓存 (写时复制)
+struct ModelSolver01_06::ReservoirMemo {
+    using Values = QHash<ReservoirResponse::Abscissa, Complex>;
+
+    QByteArray key;
+    QSharedPointer<const ReservoirResponse> cached;
+    quint64 id = nextId();
+    QMutex mutex;                          // 只保护 locals 的登记 (每个线程每次调用一次)
+    QVector<QSharedPointer<Values>> locals;
+
+    template <typename F>
+    Complex value(Complex z, F compute) {
+        ReservoirResponse::Abscissa a = ReservoirResponse::abscissa(z);
+        if (cached) {
+            auto it = cached->values.constFind(a);
+            if (it != cached->values.constEnd()) return it.value();
+        }
+        Values& fresh = local();
+        auto it = fresh.constFind(a);
+        if (it != fresh.constEnd()) return it.value();
+        Complex v = compute();
+        fresh.insert(a, v);
+        return v;
+    }
+
+    void commit() {
+        int freshCount = 0;
+        for (const QSharedPointer<Values>& values : locals) freshCount += values->size();
+        if (freshCount == 0) return;
+        QSharedPointer<ReservoirResponse> merged(new ReservoirResponse);
+        if (cached && cached->values.size() + freshCount <= kReservoirCacheMaxAbscissae) merged->values = cached->values;
+        for (const QSharedPointer<Values>& values : locals) merged->values.insert(*values);
+        ReservoirResponseCache::shared().insert(key, merged);
+    }
+
+private:
+    static quint64 nextId() {
+        static std::atomic<quint64> counter(0);
+        return ++counter;
+    }
+
+    // 本线程的新增值表: 线程局部的小表按查表编号记住最近用过的几个查表 (编号不复用，已销毁查表的残留项不会再命中)，
+    // 未记住时登记一张新表，同一线程偶尔登记两张只影响复用率
+    Values& local() {
+        struct Slot { quint64 id; Values* values; };
+        static thread_local Slot recent[4] = {};
+        static thread_local int next = 0;
+        for (const Slot& slot : recent) {
+            if (slot.id == id) return *slot.values;
+        }
+        QSharedPointer<Values> values(new Values);
+        {
+            QMutexLocker locker(&mutex);
+            locals.append(values);
+        }
+        recent[next] = Slot{ id, values.data() };
+        next = (next + 1) % 4;
+        return *values;
+    }
+};
+
+// 求解器专用线程池 (与 QThreadPool::globalInstance 分离，拟合任务本身运行在全局池中)
+QThreadPool* ModelSolver01_06::solverThreadPool()
 {
-    m_highPrecision = high;
+    static QThreadPool pool;
+    return &pool;
+}
+
+// 设置时间点并行计算的最大线程数 (<=0 表示使用 CPU 核心数，1 表示串行)
+void ModelSolver01_06::setMaxThreadCount(int count)
+{
+    solverThreadPool()->setMaxThreadCount(count > 0 ? count : QThread::idealThreadCount());
+}
+
+int ModelSolver01_06::maxThreadCount()
+{
+    return solverThreadPool()->maxThreadCount();
+}
+
+ModelSolver01_06::SerialScope::SerialScope() : m_previous(t_inSolverWorker)
+{
+    t_inSolverWorker = true;
+}
+
+ModelSolver01_06::SerialScope::~SerialScope()
+{
+    t_inSolverWorker = m_previous;
 }
 
 // 获取模型名称
@@ -66,232 +236,1096 @@ QVector<double> ModelSolver01_06::generateLogTimeSteps(int count, double startEx
 }
 
 // 核心计算函数
-ModelCurveData ModelSolver01_06::calculateTheoreticalCurve(const QMap<QString, double>& params, const QVector<double>& providedTime)
+ModelCurveData ModelSolver01_06::calculateTheoreticalCurve(const QMap<QString, double>& params, const QVector<double>& providedTime,
+                                                           const SolverOptions& options) const
+{
+    return calculateTheoreticalCurve(ModelParams::fromMap(params), providedTime, options);
+}
+
+ModelCurveData ModelSolver01_06::calculateTheoreticalCurve(const ModelParams& params, const QVector<double>& providedTime,
+                                                           const SolverOptions& options) const
 {
-    // 1. 准备时间序列
+    return calculateTheoreticalCurves(QVector<ModelParams>(1, params), providedTime, options).first();
+}
+
+// 统计模式: 本次调用的计数先记入局部记录 (并行段中各工作线程再各用一份，并行段结束时由调用线程合并)，
+// 完成后一次加锁合并到调用方记录，调用方可在多个线程中共用同一记录
+QVector<ModelCurveData> ModelSolver01_06::calculateTheoreticalCurves(const QVector<ModelParams>& paramSets, const QVector<double>& providedTime,
+                                                                     const SolverOptions& options) const
+{
+#ifdef WELLTEST_SOLVER_STATS
+    if (options.stats) {
+        SolverStats local;
+        QVector<ModelCurveData> results;
+        {
+            SolverStats::Scope scope(&local);
+            SOLVER_STATS_PHASE(totalMs);
+            SOLVER_STATS_ADD(curves, paramSets.size());
+            results = computeCurves(paramSets, providedTime, options);
+        }
+        SolverStats::mergeInto(options.stats, local);
+        return results;
+    }
+#endif
+    return computeCurves(paramSets, providedTime, options);
+}
+
+// 批量计算: 时间序列、反演引擎只准备一次；各参数组的反演准备 (阶数、拉普拉斯插值) 完成后，
+// (储层响应组 × 时间点) 的反演任务展平为一个序列统一分发到线程池，组少点多与组多点少时都能占满线程
+QVector<ModelCurveData> ModelSolver01_06::computeCurves(const QVector<ModelParams>& inputSets, const QVector<double>& providedTime,
+                                                        const SolverOptions& options) const
+{
+    // 参数块副本写入本次调用的积分设置 (核函数只接收参数块)
+    QVector<ModelParams> paramSets = inputSets;
+    for (ModelParams& p : paramSets) {
+        p.quadratureTolerance = options.quadratureTolerance;
+        p.quadratureMaxDepth = options.quadratureMaxDepth;
+    }
+    int numSets = paramSets.size();
+    QVector<ModelCurveData> results(numSets);
+    if (numSets == 0) return results;
+
+    // 1. 准备时间序列 (各参数组共用)
     QVector<double> tPoints = providedTime;
     if (tPoints.isEmpty()) {
         tPoints = generateLogTimeSteps(100, -3.0, 3.0);
     }
+    int numPoints = tPoints.size();
+
+    // 2. 计算各参数组的无因次时间 tD
+    QVector<QVector<double>> tD(numSets), PD(numSets), Deriv(numSets);
+    for (int s = 0; s < numSets; ++s) {
+        dimensionlessTime(paramSets[s], tPoints, tD[s]);
+    }
 
-    // 2. 提取物理参数
-    double phi = params.value("phi", 0.05);
-    double mu = params.value("mu", 0.5);
-    double B = params.value("B", 1.05);
-    double Ct = params.value("Ct", 5e-4);
-    double q = params.value("q", 5.0);
-    double h = params.value("h", 20.0);
-    double kf = params.value("kf", 1e-3);
-    double L = params.value("L", 1000.0);
+    // 3. 典型曲线缓存与粗网格模式按参数组逐条处理 (内部已按时间点并行)，其余参数组进入统一反演
+    QVector<int> pending;
+    for (int s = 0; s < numSets; ++s) {
+        bool done = false;
+        if (options.typeCurveCache) {
+            SOLVER_STATS_PHASE(typeCurveMs);
+            done = interpolateTypeCurve(tD[s], paramSets[s], options, PD[s], Deriv[s]);
+        }
+        if (!done && options.coarseGridTolerance > 0.0) {
+            SOLVER_STATS_PHASE(coarseGridMs);
+            done = solveOnCoarseGrid(tD[s], paramSets[s], options, PD[s], Deriv[s]);
+        }
+        if (!done) pending.append(s);
+    }
+
+    // 4. 统一反演: 逐组准备 (插值节点在组内并行)，再按 (储层响应组 × 时间点) 分发；
+    //    储层参数相同的参数组 (如 cD、S 敏感性分析) 归入同一储层响应组、共用同一储层响应查表，
+    //    同一时间点的各组在同一任务内依次反演，拉普拉斯变量相同的储层响应直接命中本线程的新增值表
+    if (!pending.isEmpty()) {
+        QSharedPointer<InversionEngine> engine = createEngine(options);
+        QHash<QByteArray, int> groupOfKey;
+        QVector<QVector<int>> groups;
+        QVector<QSharedPointer<ReservoirMemo>> memos;
+        QVector<InversionSetup> setups(pending.size());
+        {
+            SOLVER_STATS_PHASE(prepareMs);
+            for (int i = 0; i < pending.size(); ++i) {
+                int s = pending[i];
+                int g = groups.size();
+                QByteArray key;
+                if (options.reservoirCache) {
+                    key = reservoirKey(m_type, paramSets[s], engine != nullptr);
+                    g = groupOfKey.value(key, g);
+                }
+                if (g == groups.size()) {
+                    if (options.reservoirCache) groupOfKey.insert(key, g);
+                    groups.append(QVector<int>());
+                    memos.append(options.reservoirCache ? createReservoirMemo(key) : QSharedPointer<ReservoirMemo>());
+                }
+                groups[g].append(i);
+                prepareInversion(tD[s], paramSets[s], options, memos[g].data(), setups[i]);
+                PD[s].resize(numPoints);
+                Deriv[s].resize(numPoints);
+            }
+        }
+        {
+            SOLVER_STATS_PHASE(inversionMs);
+            QVector<QVector<char>> solved;
+            auto invertJob = [&](int job) {
+                int g = job / numPoints, k = job % numPoints;
+                for (int i : groups[g]) {
+                    if (!solved.isEmpty() && solved[i][k]) continue;
+                    int s = pending[i];
+                    invertPoint(setups[i], options, engine.data(), tD[s][k], PD[s][k], Deriv[s][k]);
+                }
+            };
+            if (options.asymptoticTolerance > 0.0) {
+                // 渐近段探测在各参数组间并行，之后只分发仍有参数组需要完整反演的点
+                solved.resize(pending.size());
+                runParallel(pending.size(), [&](int i) {
+                    int s = pending[i];
+                    solveAsymptoticRegimes(setups[i], options, engine.data(), tD[s], PD[s], Deriv[s], solved[i]);
+                });
+                QVector<int> jobs;
+                for (int g = 0; g < groups.size(); ++g) {
+                    for (int k = 0; k < numPoints; ++k) {
+                        bool open = false;
+                        for (int i : groups[g]) open = open || !solved[i][k];
+                        if (open) jobs.append(g * numPoints + k);
+                    }
+                }
+                runParallel(jobs.size(), [&](int j) { invertJob(jobs[j]); });
+            } else {
+                runParallel(groups.size() * numPoints, invertJob);
+            }
+        }
+        for (const QSharedPointer<ReservoirMemo>& memo : memos) {
+            if (memo) memo->commit();
+        }
+    }
+
+    // 5. 将无因次量转换为物理量 (压差 dp)
+    for (int s = 0; s < numSets; ++s) {
+        double p_coeff = pressureCoefficient(paramSets[s]);
+        QVector<double> finalP(numPoints), finalDP(numPoints);
+        for (int i = 0; i < numPoints; ++i) {
+            finalP[i] = p_coeff * PD[s][i];
+            finalDP[i] = p_coeff * Deriv[s][i];
+        }
+        results[s] = std::make_tuple(tPoints, finalP, finalDP);
+    }
+    return results;
+}
+
+// 物理时间换算为无因次时间
+void ModelSolver01_06::dimensionlessTime(const ModelParams& params, const QVector<double>& t, QVector<double>& tD)
+{
+    double phi = params[ModelParams::Phi];
+    double mu = params[ModelParams::Mu];
+    double Ct = params[ModelParams::Ct];
+    double kf = params[ModelParams::Kf];
+    double L = params[ModelParams::L];
 
-    // 3. 计算无因次时间 tD
-    QVector<double> tD_vec;
-    tD_vec.reserve(tPoints.size());
     // 系数 14.4 是考虑单位转换后的常数 (具体取决于单位制，此处沿用原代码逻辑)
     // tD = 0.0036 * k * t / (phi * mu * Ct * L^2) ? 需确认原公式系数
     // 原代码使用 14.4，这里保持一致
     // 修正：通常 field unit 下 tD = 0.0002637... 但此处原代码系数为 14.4，可能是特定单位制
     double td_coeff = 14.4 * kf / (phi * mu * Ct * pow(L, 2));
 
-    for(double t : tPoints) {
-        double val = td_coeff * t;
-        tD_vec.append(val);
+    tD.resize(t.size());
+    for (int i = 0; i < t.size(); ++i) tD[i] = td_coeff * t[i];
+}
+
+// 无因次压力换算为压差的系数: dp = 1.842e-3 * q * mu * B / (k * h) * pD
+double ModelSolver01_06::pressureCoefficient(const ModelParams& params)
+{
+    double mu = params[ModelParams::Mu];
+    double B = params[ModelParams::B];
+    double q = params[ModelParams::Q];
+    double h = params[ModelParams::H];
+    double kf = params[ModelParams::Kf];
+    return 1.842e-3 * q * mu * B / (kf * h);
+}
+
+void ModelSolver01_06::solveDimensionless(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                                          QVector<double>& outPD, QVector<double>& outDeriv) const
+{
+    int numPoints = tD.size();
+    outPD.resize(numPoints);
+    outDeriv.resize(numPoints);
+
+    QSharedPointer<InversionEngine> engine = createEngine(options);
+    QSharedPointer<ReservoirMemo> memo;
+    if (options.reservoirCache) memo = createReservoirMemo(reservoirKey(m_type, params, engine != nullptr));
+    InversionSetup setup;
+    prepareInversion(tD, params, options, memo.data(), setup);
+    if (options.asymptoticTolerance > 0.0) {
+        QVector<char> solved;
+        solveAsymptoticRegimes(setup, options, engine.data(), tD, outPD, outDeriv, solved);
+        QVector<int> rest;
+        for (int k = 0; k < numPoints; ++k) if (!solved[k]) rest.append(k);
+        runParallel(rest.size(), [&](int j) {
+            int k = rest[j];
+            invertPoint(setup, options, engine.data(), tD[k], outPD[k], outDeriv[k]);
+        });
+    } else {
+        runParallel(numPoints, [&](int k) {
+            invertPoint(setup, options, engine.data(), tD[k], outPD[k], outDeriv[k]);
+        });
     }
+    if (memo) memo->commit();
+}
 
-    // 4. 计算无因次压力和导数
-    QVector<double> PD_vec, Deriv_vec;
-    auto func = std::bind(&ModelSolver01_06::flaplace_composite, this, std::placeholders::_1, std::placeholders::_2);
-    calculatePDandDeriv(tD_vec, params, func, PD_vec, Deriv_vec);
+// 储层响应查表: 从缓存取出该储层参数组的快照
+QSharedPointer<ModelSolver01_06::ReservoirMemo> ModelSolver01_06::createReservoirMemo(const QByteArray& key)
+{
+    QSharedPointer<ReservoirMemo> memo(new ReservoirMemo);
+    memo->key = key;
+    memo->cached = ReservoirResponseCache::shared().find(key);
+    return memo;
+}
 
-    // 5. 将无因次量转换为物理量 (压差 dp)
-    // dp = 1.842e-3 * q * mu * B / (k * h) * pD
-    double p_coeff = 1.842e-3 * q * mu * B / (kf * h);
+// 储层响应缓存键: 边界类型、标量类型与储层参数 (不含 cD、S、gamaD 及只影响 tD 与压力缩放的参数)
+QByteArray ModelSolver01_06::reservoirKey(ModelType type, const ModelParams& params, bool complexAbscissae)
+{
+    double values[] = {
+        params[ModelParams::Kf] / params[ModelParams::Km],
+        params[ModelParams::LfD],
+        params[ModelParams::RmD],
+        params[ModelParams::ReD],
+        params[ModelParams::Omega1],
+        params[ModelParams::Omega2],
+        params[ModelParams::Lambda1],
+        std::max(1.0, std::floor(params[ModelParams::Nf])),
+        params.quadratureTolerance,
+        (double)params.quadratureMaxDepth
+    };
+    int flags[] = {
+        (int)type / 2, // 边界类型 (井储条件不影响储层响应)
+        complexAbscissae ? 1 : 0
+    };
+    if (type == Model_1 || type == Model_2) values[3] = 0.0; // 无限大边界不使用 reD
 
-    QVector<double> finalP(tPoints.size()), finalDP(tPoints.size());
+    QByteArray key;
+    key.append(reinterpret_cast<const char*>(flags), sizeof(flags));
+    key.append(reinterpret_cast<const char*>(values), sizeof(values));
+    if (params.geometry && !params.geometry->isEmpty()) key.append(params.geometry->key());
+    return key;
+}
 
-    for(int i=0; i<tPoints.size(); ++i) {
-        finalP[i] = p_coeff * PD_vec[i];
-        finalDP[i] = p_coeff * Deriv_vec[i];
+// 拉普拉斯空间求值: 启用储层响应缓存时，储层响应查表后再施加井储与表皮
+double ModelSolver01_06::laplaceValue(const InversionSetup& setup, double z) const
+{
+    const ModelParams& params = *setup.params;
+    if (!setup.memo) {
+        SOLVER_STATS_ADD(laplaceEvaluations, 1);
+        return m_kernel(z, params);
     }
+    LaplaceKernel kernel = m_reservoirKernel;
+    double pf = setup.memo->value(Complex(z, 0.0), [&]() {
+        SOLVER_STATS_ADD(laplaceEvaluations, 1);
+        return Complex(kernel(z, params), 0.0);
+    }).real();
+    return m_hasStorage ? applyWellboreStorage(z, pf, params) : pf;
+}
 
-    return std::make_tuple(tPoints, finalP, finalDP);
+Complex ModelSolver01_06::laplaceValue(const InversionSetup& setup, Complex s) const
+{
+    const ModelParams& params = *setup.params;
+    if (!setup.memo) {
+        SOLVER_STATS_ADD(laplaceEvaluations, 1);
+        SOLVER_STATS_ADD(complexEvaluations, 1);
+        return m_complexKernel(s, params);
+    }
+    ComplexLaplaceKernel kernel = m_complexReservoirKernel;
+    Complex pf = setup.memo->value(s, [&]() {
+        SOLVER_STATS_ADD(laplaceEvaluations, 1);
+        SOLVER_STATS_ADD(complexEvaluations, 1);
+        return kernel(s, params);
+    });
+    return m_hasStorage ? applyWellboreStorage(s, pf, params) : pf;
 }
 
-// Stehfest 数值反演计算 PD 和导数
-void ModelSolver01_06::calculatePDandDeriv(const QVector<double>& tD, const QMap<QString, double>& params,
-                                           std::function<double(double, const QMap<QString, double>&)> laplaceFunc,
-                                           QVector<double>& outPD, QVector<double>& outDeriv)
+// 典型曲线缓存: 曲线网格按整对数周期对齐并向两侧各外扩一个周期，拟合中 tD 的小幅平移不会导致重建；
+// 已缓存曲线不能覆盖请求范围时，以两者范围的并集重建
+bool ModelSolver01_06::interpolateTypeCurve(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                                            QVector<double>& outPD, QVector<double>& outDeriv) const
 {
+    double tMin = 0.0, tMax = 0.0;
+    for (double t : tD) {
+        if (t <= 1e-12) continue;
+        if (tMin == 0.0 || t < tMin) tMin = t;
+        if (t > tMax) tMax = t;
+    }
+    if (tMax <= 0.0) return false;
+
+    TypeCurveCache& cache = TypeCurveCache::shared();
+    QByteArray key = typeCurveKey(m_type, params, options);
+    QSharedPointer<const TypeCurve> curve = cache.find(key);
+    if (!curve || !curve->covers(tMin, tMax)) {
+        double lo = tMin, hi = tMax;
+        if (curve) {
+            lo = std::min(lo, curve->pd.xMin());
+            hi = std::max(hi, curve->pd.xMax());
+        }
+        double e0 = 0.0, e1 = 0.0;
+        int n = typeCurveGrid(lo, hi, options, e0, e1);
+        QVector<double> grid = generateLogTimeSteps(n, e0, e1);
+        QVector<double> gridPD, gridDeriv;
+        solveDimensionless(grid, params, options, gridPD, gridDeriv);
+
+        QSharedPointer<TypeCurve> built(new TypeCurve);
+        if (!built->pd.build(grid, gridPD) || !built->deriv.build(grid, gridDeriv)) return false;
+        cache.insert(key, built);
+        curve = built;
+    }
+
     int numPoints = tD.size();
     outPD.resize(numPoints);
     outDeriv.resize(numPoints);
+    for (int k = 0; k < numPoints; ++k) {
+        if (tD[k] <= 1e-12) { outPD[k] = 0; outDeriv[k] = 0; continue; }
+        outPD[k] = curve->pd.eval(tD[k]);
+        outDeriv[k] = curve->deriv.eval(tD[k]);
+    }
+    return true;
+}
 
-    int N_param = (int)params.value("N", 4);
-    int N = m_highPrecision ? N_param : 4;
-    if (N % 2 != 0) N = 4;
-    double ln2 = log(2.0);
+// 粗网格模式: 初始网格在 [tMin, tMax] 上按对数等距分布；每一轮对所有待检区间的对数中点做一次批量求解，
+// 与当前网格插值结果比较，误差超限的区间对分后进入下一轮。中点无论是否超限都并入网格。
+// 相对误差的分母不小于曲线最大值的 1e-3 倍，避免导数趋于零的晚期段无限加密。
+// 加密受点数上限约束 (kCoarseGridMaxPoints 与请求点数的一半)，上限内未能全部达到容差时返回 false
+bool ModelSolver01_06::solveOnCoarseGrid(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                                         QVector<double>& outPD, QVector<double>& outDeriv) const
+{
+    int numPoints = tD.size();
+    if (numPoints <= kCoarseGridMinPoints) return false;
+    double tMin = 0.0, tMax = 0.0;
+    for (double t : tD) {
+        if (t <= 1e-12) continue;
+        if (tMin == 0.0 || t < tMin) tMin = t;
+        if (t > tMax) tMax = t;
+    }
+    if (!(tMax > tMin)) return false;
+
+    double e0 = std::log10(tMin), e1 = std::log10(tMax);
+    double perDecade = kCoarseGridPointsPerDecade * std::max(0.25, options.gridDensity);
+    int n0 = std::max(2, (int)std::ceil((e1 - e0) * perDecade) + 1);
+    int maxPoints = std::min(kCoarseGridMaxPoints, numPoints / 2);
+    if (n0 >= maxPoints) return false;
+
+    QVector<double> gridT = generateLogTimeSteps(n0, e0, e1);
+    gridT.first() = tMin;
+    gridT.last() = tMax;
+    QVector<double> gridPD, gridDeriv;
+    solveDimensionless(gridT, params, options, gridPD, gridDeriv);
+
+    auto scaleOf = [](const QVector<double>& v) {
+        double m = 0.0;
+        for (double x : v) m = std::max(m, std::abs(x));
+        return m;
+    };
+
+    LogLogInterpolator pdCurve, derivCurve;
+    QVector<QPair<double, double>> pending;
+    for (int i = 0; i + 1 < gridT.size(); ++i) pending.append(qMakePair(gridT[i], gridT[i + 1]));
+
+    while (!pending.isEmpty() && gridT.size() + pending.size() <= maxPoints) {
+        if (!pdCurve.build(gridT, gridPD) || !derivCurve.build(gridT, gridDeriv)) return false;
+
+        QVector<double> midT(pending.size());
+        for (int i = 0; i < pending.size(); ++i) midT[i] = std::sqrt(pending[i].first * pending[i].second);
+        QVector<double> midPD, midDeriv;
+        solveDimensionless(midT, params, options, midPD, midDeriv);
+
+        double pdFloor = 1e-3 * scaleOf(gridPD);
+        double derivFloor = 1e-3 * scaleOf(gridDeriv);
+        QVector<QPair<double, double>> next;
+        for (int i = 0; i < pending.size(); ++i) {
+            double errPD = std::abs(pdCurve.eval(midT[i]) - midPD[i]) / std::max(std::abs(midPD[i]), pdFloor);
+            double errDeriv = std::abs(derivCurve.eval(midT[i]) - midDeriv[i]) / std::max(std::abs(midDeriv[i]), derivFloor);
+            if (!(std::max(errPD, errDeriv) <= options.coarseGridTolerance)) {
+                next.append(qMakePair(pending[i].first, midT[i]));
+                next.append(qMakePair(midT[i], pending[i].second));
+            }
+        }
 
-    double gamaD = params.value("gamaD", 0.0);
+        // 中点并入网格 (两者均有序，归并)
+        QVector<double> mergedT, mergedPD, mergedDeriv;
+        mergedT.reserve(gridT.size() + midT.size());
+        mergedPD.reserve(gridT.size() + midT.size());
+        mergedDeriv.reserve(gridT.size() + midT.size());
+        int a = 0, b = 0;
+        while (a < gridT.size() || b < midT.size()) {
+            if (b >= midT.size() || (a < gridT.size() && gridT[a] < midT[b])) {
+                mergedT.append(gridT[a]); mergedPD.append(gridPD[a]); mergedDeriv.append(gridDeriv[a]); ++a;
+            } else {
+                mergedT.append(midT[b]); mergedPD.append(midPD[b]); mergedDeriv.append(midDeriv[b]); ++b;
+            }
+        }
+        gridT.swap(mergedT);
+        gridPD.swap(mergedPD);
+        gridDeriv.swap(mergedDeriv);
+        pending.swap(next);
+    }
+    // 达到点数上限时仍有区间超限: 插值误差没有得到检验，交由调用方在全部请求点上直接求解
+    if (!pending.isEmpty()) return false;
 
+    if (!pdCurve.build(gridT, gridPD) || !derivCurve.build(gridT, gridDeriv)) return false;
+    outPD.resize(numPoints);
+    outDeriv.resize(numPoints);
     for (int k = 0; k < numPoints; ++k) {
-        double t = tD[k];
-        if (t <= 1e-12) { outPD[k] = 0; continue; }
+        if (tD[k] <= 1e-12) { outPD[k] = 0; outDeriv[k] = 0; continue; }
+        outPD[k] = pdCurve.eval(tD[k]);
+        outDeriv[k] = derivCurve.eval(tD[k]);
+    }
+    return true;
+}
+
+int ModelSolver01_06::typeCurveGrid(double tMin, double tMax, const SolverOptions& options, double& e0, double& e1)
+{
+    e0 = std::floor(std::log10(tMin)) - 1.0;
+    e1 = std::ceil(std::log10(tMax)) + 1.0;
+    double perDecade = kTypeCurvePointsPerDecade * std::max(0.25, options.gridDensity);
+    return (int)std::lround((e1 - e0) * perDecade) + 1;
+}
+
+bool ModelSolver01_06::sharesTypeCurve(ModelType type, const ModelParams& a, const ModelParams& b, const SolverOptions& options)
+{
+    return typeCurveKey(type, a, options) == typeCurveKey(type, b, options);
+}
+
+int ModelSolver01_06::typeCurveGridPoints(const ModelParams& params, const QVector<double>& t, const SolverOptions& options)
+{
+    QVector<double> tD;
+    dimensionlessTime(params, t, tD);
+    double tMin = 0.0, tMax = 0.0;
+    for (double v : tD) {
+        if (v <= 1e-12) continue;
+        if (tMin == 0.0 || v < tMin) tMin = v;
+        if (v > tMax) tMax = v;
+    }
+    if (tMax <= 0.0) return 0;
+    double e0 = 0.0, e1 = 0.0;
+    return typeCurveGrid(tMin, tMax, options, e0, e1);
+}
+
+// 缓存键只含影响无因次解的量: kf、km 只以比值 M12 进入核函数；无井储模型不使用 CD 与 S
+QByteArray ModelSolver01_06::typeCurveKey(ModelType type, const ModelParams& params, const SolverOptions& options)
+{
+    bool hasStorage = (type == Model_1 || type == Model_3 || type == Model_5);
+    double values[] = {
+        params[ModelParams::Kf] / params[ModelParams::Km],
+        params[ModelParams::LfD],
+        params[ModelParams::RmD],
+        params[ModelParams::ReD],
+        params[ModelParams::Omega1],
+        params[ModelParams::Omega2],
+        params[ModelParams::Lambda1],
+        std::max(1.0, std::floor(params[ModelParams::Nf])),
+        hasStorage ? params[ModelParams::CD] : 0.0,
+        hasStorage ? params[ModelParams::S] : 0.0,
+        params[ModelParams::GamaD],
+        (options.stehfestN > 0) ? 0.0 : params[ModelParams::N],
+        options.stehfestTolerance,
+        options.quadratureTolerance,
+        options.gridDensity,
+        options.asymptoticTolerance
+    };
+    int flags[] = {
+        (int)type,
+        options.highPrecision ? 1 : 0,
+        options.stehfestN,
+        options.stehfestMaxN,
+        options.laplaceInterpolation ? 1 : 0,
+        (int)options.inversion,
+        options.inversionOrder,
+        options.quadratureMaxDepth
+    };
+    if (type == Model_1 || type == Model_2) values[3] = 0.0; // 无限大边界不使用 reD
+
+    QByteArray key;
+    key.append(reinterpret_cast<const char*>(flags), sizeof(flags));
+    key.append(reinterpret_cast<const char*>(values), sizeof(values));
+    if (params.geometry && !params.geometry->isEmpty()) key.append(params.geometry->key());
+    return key;
+}
+
+// 复平面反演引擎 (Talbot、de Hoog、Euler)；Stehfest 走实数路径，返回空指针
+QSharedPointer<InversionEngine> ModelSolver01_06::createEngine(const SolverOptions& options)
+{
+    if (options.inversion == InversionMethod::Stehfest) return QSharedPointer<InversionEngine>();
+    int order = (options.inversionOrder > 0) ? options.inversionOrder
+                                             : InversionEngine::defaultOrder(options.inversion, options.highPrecision);
+    return InversionEngine::create(options.inversion, order);
+}
+
+// 反演准备: 确定 Stehfest 阶数范围；插值模式下在所需 ln z 区间上一次性采样 Chebyshev 节点，
+// 之后所有 Stehfest 横坐标均由插值给出
+void ModelSolver01_06::prepareInversion(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                                        ReservoirMemo* memo, InversionSetup& setup) const
+{
+    setup.params = &params;
+    setup.memo = memo;
+    setup.useInterp = false;
+    if (options.inversion != InversionMethod::Stehfest) return;
+
+    int N_param = (options.stehfestN > 0) ? options.stehfestN : (int)params[ModelParams::N];
+    int N = options.highPrecision ? N_param : 4;
+    if (N < 2 || N % 2 != 0 || N > StehfestInversion::kMaxOrder) N = 4;
+    // 自适应阶数上限 (仅高精度模式): 各时间点从 N 起逐次加 2 阶，节点 z_m = m·ln2/t 逐阶嵌套，只需补算新增的两个点
+    int maxN = N;
+    if (options.highPrecision && options.stehfestMaxN > N) {
+        maxN = std::min(options.stehfestMaxN, (int)StehfestInversion::kMaxOrder);
+        maxN -= maxN % 2;
+    }
+    setup.N = N;
+    setup.maxN = maxN;
 
-        double pd_val = 0.0;
-        for (int m = 1; m <= N; ++m) {
+    int numPoints = tD.size();
+    double weightSum = 0.0;
+    for (const DoubleDouble& v : StehfestInversion::weights(maxN)) weightSum += std::abs(v.value());
+    setup.interpTolerance = kInterpErrorBudget / weightSum;
+    if (options.laplaceInterpolation && numPoints * N > 4 * kInterpMaxNodes && setup.interpTolerance >= kInterpMinTolerance) {
+        double tMin = 0.0, tMax = 0.0;
+        for (double t : tD) {
+            if (t <= 1e-12) continue;
+            if (tMin == 0.0 || t < tMin) tMin = t;
+            if (t > tMax) tMax = t;
+        }
+        double ln2 = log(2.0);
+        auto pbar = [this, &setup](double z) { return laplaceValue(setup, z); };
+        setup.useInterp = tMax > 0.0 && buildLaplaceInterpolant(ln2 / tMax, maxN * ln2 / tMin, setup.interpTolerance,
+                                                                 pbar, setup.interp);
+    }
+}
+
+// 单个时间点的反演，各点相互独立，只写入自己的输出位置
+// Stehfest: 导数 dpD/dln(tD) = tD * dpD/dtD，而 L{dpD/dtD} = z*p(z) (pD(0) = 0)，与压力共用同一组拉普拉斯求值；
+// 系数交替且量级随 N 迅速增大，乘积与求和以双倍双精度补偿 (MSVC 的 long double 与 double 相同，不能依赖)。
+// 导数 = ln2²/t · Σ m·V_m·p_m。复平面引擎同样由一组复数求值同时给出压力与导数
+void ModelSolver01_06::invertPoint(const InversionSetup& setup, const SolverOptions& options, const InversionEngine* engine,
+                                   double t, double& outPD, double& outDeriv) const
+{
+    if (t <= 1e-12) { outPD = 0; outDeriv = 0; return; }
+    const ModelParams& params = *setup.params;
+
+    if (engine) {
+        engine->invert([this, &setup](Complex s) { return laplaceValue(setup, s); }, t, outPD, outDeriv);
+        applyPressureSensitivity(params[ModelParams::GamaD], outPD, outDeriv);
+        return;
+    }
+
+    double ln2 = log(2.0);
+    double pf[StehfestInversion::kMaxOrder + 1];
+    int evaluated = 0;
+    double bestPD = 0.0, bestDeriv = 0.0, prevDiff = HUGE_VAL, prevPD = 0.0, prevDeriv = 0.0;
+    for (int n = setup.N; n <= setup.maxN; n += 2) {
+        for (; evaluated < n; ++evaluated) {
+            int m = evaluated + 1;
             double z = m * ln2 / t;
-            double pf = laplaceFunc(z, params);
-            if (std::isnan(pf) || std::isinf(pf)) pf = 0.0;
-            pd_val += stefestCoefficient(m, N) * pf;
+            double v = setup.useInterp ? setup.interp.eval(z) : laplaceValue(setup, z);
+            pf[m] = (std::isnan(v) || std::isinf(v)) ? 0.0 : v;
         }
-        outPD[k] = pd_val * ln2 / t;
+        const QVector<DoubleDouble>& V = StehfestInversion::weights(n);
+        DoubleDouble pd_val, deriv_val;
+        double pdAbs = 0.0, derivAbs = 0.0;
+        for (int m = 1; m <= n; ++m) {
+            DoubleDouble term = V[m] * pf[m];
+            pd_val += term;
+            deriv_val += term * (double)m;
+            pdAbs += std::abs(term.value());
+            derivAbs += std::abs(term.value()) * m;
+        }
+        double pd = pd_val.value() * ln2 / t;
+        double deriv = deriv_val.value() * ln2 * ln2 / t;
+        // p(z) 的相对误差 (插值误差或双精度舍入) 经交错求和放大后的结果相对误差 (噪声水平)
+        double noise = (setup.useInterp ? setup.interpTolerance : kStehfestValueError) * std::max(pdAbs / std::max(std::abs(pd_val.value()), 1e-300),
+                                                      derivAbs / std::max(std::abs(deriv_val.value()), 1e-300));
 
-        // 考虑压敏效应修正
-        if (std::abs(gamaD) > 1e-9) {
-            double arg = 1.0 - gamaD * outPD[k];
-            if (arg > 1e-12) {
-                outPD[k] = -1.0 / gamaD * std::log(arg);
-            }
+        // 相邻两阶的相对差 (压力与导数取大者) 作为误差估计。低阶结果可能偶然接近，单个小差值不可信:
+        // 相对差连续两步缩小且满足判据才接受。相对差增大且已处于舍入噪声水平时，更高阶只会放大舍入误差，
+        // 取此前的最高一阶；远高于噪声的增大是截断误差的振荡，继续升阶
+        double diff = HUGE_VAL;
+        if (n > setup.N) {
+            diff = std::max(std::abs(pd - prevPD) / std::max(std::abs(pd), 1e-300),
+                            std::abs(deriv - prevDeriv) / std::max(std::abs(deriv), 1e-300));
         }
+        bool shrinking = n > setup.N && diff <= prevDiff; // 首个差值视为缩小
+        if (n > setup.N && !shrinking && diff <= kStehfestNoiseFactor * noise) break;
+        bestPD = pd;
+        bestDeriv = deriv;
+        if (shrinking && n >= setup.N + 4 && diff <= options.stehfestTolerance) break;
+        if (n > setup.N) prevDiff = diff;
+        prevPD = pd;
+        prevDeriv = deriv;
     }
+    outPD = bestPD;
+    outDeriv = bestDeriv;
+    applyPressureSensitivity(params[ModelParams::GamaD], outPD, outDeriv);
+}
 
-    // 计算导数 (Bourdet 导数)
-    if (numPoints > 2) {
-        // 依赖外部库 PressureDerivativeCalculator
-        outDeriv = PressureDerivativeCalculator::calculateBourdetDerivative(tD, outPD, 0.1);
+// 渐近段捷径: 请求点按 tD 排序后，先以最晚点为锚点、再以最早点为锚点，二分查找幂律渐近式成立的最长区间。
+// 候选区间的指数由两端点完整反演的导数确定，再以远端压力及区间内对数位置 1/2、3/4 处完整反演的压力和导数检验，
+// 相对误差均不超过 asymptoticTolerance 才接受 (渐近式越靠近锚点越准确，区间越长越难满足)；
+// 接受区间内其余点按幂律式给出，过渡段与未通过检验的区间仍逐点完整反演
+int ModelSolver01_06::solveAsymptoticRegimes(const InversionSetup& setup, const SolverOptions& options, const InversionEngine* engine,
+                                             const QVector<double>& tD, QVector<double>& outPD, QVector<double>& outDeriv,
+                                             QVector<char>& solved) const
+{
+    int numPoints = tD.size();
+    solved.fill(0, numPoints);
+    QVector<int> order; // 有效点下标，按 tD 升序
+    order.reserve(numPoints);
+    for (int k = 0; k < numPoints; ++k) {
+        if (tD[k] <= 1e-12) { outPD[k] = 0; outDeriv[k] = 0; solved[k] = 1; }
+        else order.append(k);
+    }
+    int m = order.size();
+    if (m < kAsymptoticMinPoints) return 0;
+    std::sort(order.begin(), order.end(), [&tD](int a, int b) { return tD[a] < tD[b]; });
+
+    double tol = 0.5 * options.asymptoticTolerance; // 检查点之间的误差可略大于检查点处，留出一半余量
+    auto within = [tol](double approx, double exact) { return std::abs(approx - exact) <= tol * std::abs(exact); };
+    // 按秩完整反演一点 (已求出的点不重复计算)
+    auto probe = [&](int r) {
+        int k = order[r];
+        if (!solved[k]) {
+            invertPoint(setup, options, engine, tD[k], outPD[k], outDeriv[k]);
+            solved[k] = 1;
+        }
+    };
+    // 从秩 ra 向秩 rb 按 ln tD 走过 frac 比例处的点的秩
+    auto rankAt = [&](int ra, int rb, double frac) {
+        double la = std::log(tD[order[ra]]), lb = std::log(tD[order[rb]]);
+        double target = std::exp(la + frac * (lb - la));
+        int lo = std::min(ra, rb), hi = std::max(ra, rb);
+        auto it = std::lower_bound(order.begin() + lo, order.begin() + hi + 1, target,
+                                   [&tD](int k, double t) { return tD[k] < t; });
+        return std::min((int)(it - order.begin()), hi);
+    };
+    // 锚点 anchor 到远端 far 的区间是否为幂律段
+    auto fitRegion = [&](int anchor, int far, PowerLawAsymptote& law) {
+        probe(anchor);
+        probe(far);
+        int ka = order[anchor], kf = order[far];
+        if (!law.fit(tD[ka], outPD[ka], outDeriv[ka], tD[kf], outDeriv[kf])) return false;
+        double p, d;
+        law.eval(tD[kf], p, d);
+        if (!within(p, outPD[kf])) return false;
+        for (double frac : { 0.5, 0.75 }) {
+            int r = rankAt(anchor, far, frac);
+            if (r == anchor || r == far) continue;
+            probe(r);
+            int k = order[r];
+            law.eval(tD[k], p, d);
+            if (!within(p, outPD[k]) || !within(d, outDeriv[k])) return false;
+        }
+        return true;
+    };
+    // 自锚点向 limit 方向二分查找最远的可接受远端，返回其秩 (未找到时为锚点本身)
+    auto extend = [&](int anchor, int limit, PowerLawAsymptote& law) {
+        int step = (limit >= anchor) ? 1 : -1;
+        int good = anchor, bad = limit + step;
+        PowerLawAsymptote trial;
+        while (std::abs(bad - good) > 1) {
+            int mid = (good + bad) / 2;
+            if (fitRegion(anchor, mid, trial)) { good = mid; law = trial; }
+            else bad = mid;
+        }
+        return good;
+    };
+
+    int filled = 0;
+    auto fill = [&](int r0, int r1, const PowerLawAsymptote& law) {
+        for (int r = r0; r <= r1; ++r) {
+            int k = order[r];
+            if (solved[k]) continue;
+            law.eval(tD[k], outPD[k], outDeriv[k]);
+            solved[k] = 1;
+            ++filled;
+        }
+    };
+
+    PowerLawAsymptote lateLaw, earlyLaw;
+    int lateStart = extend(m - 1, 0, lateLaw);
+    if (lateStart < m - 1) fill(lateStart, m - 1, lateLaw);
+    if (lateStart > 1) {
+        int earlyEnd = extend(0, lateStart - 1, earlyLaw);
+        if (earlyEnd > 0) fill(0, earlyEnd, earlyLaw);
+    }
+    SOLVER_STATS_ADD(asymptoticPoints, filled);
+    return filled;
+}
+
+// 考虑压敏效应修正: pD' = -ln(1 - γ pD) / γ，导数按链式法则 d(pD')/dln t = (dpD/dln t) / (1 - γ pD)
+void ModelSolver01_06::applyPressureSensitivity(double gamaD, double& pd, double& deriv)
+{
+    if (std::abs(gamaD) > 1e-9) {
+        double arg = 1.0 - gamaD * pd;
+        if (arg > 1e-12) {
+            pd = -1.0 / gamaD * std::log(arg);
+            deriv /= arg;
+        }
+    }
+}
+
+// 将 count 个相互独立的任务分发到求解器线程池；任务较少或已处于池内线程时串行执行，避免嵌套等待。
+// 每个工作线程只提交一个池任务，从共享计数器逐个领取下标 (动态分配，各点耗时不均时仍能均衡)。
+// 调用线程正在统计时，每个工作线程的计数记入各自的局部记录，全部完成后由调用线程一次合并，任务执行期间不加锁
+void ModelSolver01_06::runParallel(int count, const std::function<void(int)>& task)
+{
+    QThreadPool* pool = solverThreadPool();
+    if (count >= 16 && pool->maxThreadCount() > 1 && !t_inSolverWorker) {
+        int workers = std::min(count, pool->maxThreadCount());
+        QVector<int> workerIds(workers);
+        std::iota(workerIds.begin(), workerIds.end(), 0);
+        SolverStats* stats = SolverStats::active();
+        QVector<SolverStats> workerStats(stats ? workers : 0);
+        std::atomic<int> next(0);
+        QtConcurrent::blockingMap(pool, workerIds, [&](int w) {
+            t_inSolverWorker = true;
+            SolverStats::Scope scope(stats ? &workerStats[w] : nullptr);
+            for (int k = next.fetch_add(1, std::memory_order_relaxed); k < count; k = next.fetch_add(1, std::memory_order_relaxed)) {
+                task(k);
+            }
+            t_inSolverWorker = false;
+        });
+        for (const SolverStats& local : workerStats) stats->merge(local);
     } else {
-        outDeriv.fill(0.0);
+        for (int k = 0; k < count; ++k) task(k);
+    }
+}
+
+// 插值求值: 重心公式 (Chebyshev-Lobatto 节点)，结果还原为 p(z)
+double ModelSolver01_06::LaplaceInterpolant::eval(double z) const
+{
+    double u = std::log(z);
+    double num = 0.0, den = 0.0;
+    int n = nodes.size();
+    for (int j = 0; j < n; ++j) {
+        double d = u - nodes[j];
+        if (std::abs(d) < 1e-14) {
+            num = values[j]; den = 1.0;
+            break;
+        }
+        double w = ((j % 2 == 0) ? 1.0 : -1.0) * ((j == 0 || j == n - 1) ? 0.5 : 1.0) / d;
+        num += w * values[j];
+        den += w;
     }
+    double g = num / den;
+    return (useLog ? std::exp(g) : g) / z;
+}
+
+// 在 [zMin, zMax] 上构建 z*p(z) 关于 ln z 的 Chebyshev 插值；
+// 节点数逐次加倍，直到检验点上与直接计算的相对误差满足要求，否则返回 false 使用直接计算
+bool ModelSolver01_06::buildLaplaceInterpolant(double zMin, double zMax, double tolerance, const std::function<double(double)>& pbar,
+                                               LaplaceInterpolant& out)
+{
+    if (!(zMax > zMin) || zMin <= 0.0) return false;
+    double a = std::log(zMin), b = std::log(zMax);
+    double mid = 0.5 * (a + b), half = 0.5 * (b - a);
+
+    for (int n = kInterpMinNodes; n <= kInterpMaxNodes; n = 2 * n - 1) {
+        QVector<double>& nodes = out.nodes;
+        QVector<double> raw(n);
+        nodes.resize(n);
+        for (int j = 0; j < n; ++j) nodes[j] = mid + half * std::cos(M_PI * j / (n - 1));
+        runParallel(n, [&](int j) {
+            double z = std::exp(nodes[j]);
+            raw[j] = z * pbar(z);
+        });
+
+        bool allFinite = true, allPositive = true;
+        for (double v : raw) {
+            if (!std::isfinite(v)) allFinite = false;
+            if (!(v > 0.0)) allPositive = false;
+        }
+        if (!allFinite) return false;
+
+        out.useLog = allPositive;
+        out.values.resize(n);
+        for (int j = 0; j < n; ++j) out.values[j] = allPositive ? std::log(raw[j]) : raw[j];
+
+        // 在相邻节点的中点上与直接计算比较 (误差最大处)
+        const int nCheck = 8;
+        QVector<double> errs(nCheck, 0.0);
+        runParallel(nCheck, [&](int c) {
+            double theta = M_PI * ((c + 0.5) * (n - 1) / nCheck + 0.5) / (n - 1);
+            double z = std::exp(mid + half * std::cos(theta));
+            double exact = pbar(z);
+            double approx = out.eval(z);
+            errs[c] = std::abs(approx - exact) / std::max(std::abs(exact), 1e-300);
+        });
+        double maxErr = *std::max_element(errs.begin(), errs.end());
+        if (maxErr < tolerance) return true;
+    }
+    return false;
+}
+
+// 按模型类型分派的特化核函数表 (下标与 ModelType 一致)
+ModelSolver01_06::LaplaceKernel ModelSolver01_06::kernelFor(ModelType type)
+{
+    static const LaplaceKernel table[] = {
+        &ModelSolver01_06::flaplace_composite<double, Boundary_Infinite, true>,        // Model_1
+        &ModelSolver01_06::flaplace_composite<double, Boundary_Infinite, false>,       // Model_2
+        &ModelSolver01_06::flaplace_composite<double, Boundary_Closed, true>,          // Model_3
+        &ModelSolver01_06::flaplace_composite<double, Boundary_Closed, false>,         // Model_4
+        &ModelSolver01_06::flaplace_composite<double, Boundary_ConstPressure, true>,   // Model_5
+        &ModelSolver01_06::flaplace_composite<double, Boundary_ConstPressure, false>   // Model_6
+    };
+    int index = (int)type;
+    if (index < 0 || index >= (int)(sizeof(table) / sizeof(table[0]))) index = 0;
+    return table[index];
+}
+
+ModelSolver01_06::ComplexLaplaceKernel ModelSolver01_06::complexKernelFor(ModelType type)
+{
+    static const ComplexLaplaceKernel table[] = {
+        &ModelSolver01_06::flaplace_composite<Complex, Boundary_Infinite, true>,
+        &ModelSolver01_06::flaplace_composite<Complex, Boundary_Infinite, false>,
+        &ModelSolver01_06::flaplace_composite<Complex, Boundary_Closed, true>,
+        &ModelSolver01_06::flaplace_composite<Complex, Boundary_Closed, false>,
+        &ModelSolver01_06::flaplace_composite<Complex, Boundary_ConstPressure, true>,
+        &ModelSolver01_06::flaplace_composite<Complex, Boundary_ConstPressure, false>
+    };
+    int index = (int)type;
+    if (index < 0 || index >= (int)(sizeof(table) / sizeof(table[0]))) index = 0;
+    return table[index];
+}
+
+// 不含井储与表皮的储层响应核函数表 (下标与 ModelType 一致，井储条件不同的模型共用同一边界的储层响应)
+ModelSolver01_06::LaplaceKernel ModelSolver01_06::reservoirKernelFor(ModelType type)
+{
+    static const LaplaceKernel table[] = {
+        &ModelSolver01_06::reservoirResponse<double, Boundary_Infinite>,
+        &ModelSolver01_06::reservoirResponse<double, Boundary_Infinite>,
+        &ModelSolver01_06::reservoirResponse<double, Boundary_Closed>,
+        &ModelSolver01_06::reservoirResponse<double, Boundary_Closed>,
+        &ModelSolver01_06::reservoirResponse<double, Boundary_ConstPressure>,
+        &ModelSolver01_06::reservoirResponse<double, Boundary_ConstPressure>
+    };
+    int index = (int)type;
+    if (index < 0 || index >= (int)(sizeof(table) / sizeof(table[0]))) index = 0;
+    return table[index];
+}
+
+ModelSolver01_06::ComplexLaplaceKernel ModelSolver01_06::complexReservoirKernelFor(ModelType type)
+{
+    static const ComplexLaplaceKernel table[] = {
+        &ModelSolver01_06::reservoirResponse<Complex, Boundary_Infinite>,
+        &ModelSolver01_06::reservoirResponse<Complex, Boundary_Infinite>,
+        &ModelSolver01_06::reservoirResponse<Complex, Boundary_Closed>,
+        &ModelSolver01_06::reservoirResponse<Complex, Boundary_Closed>,
+        &ModelSolver01_06::reservoirResponse<Complex, Boundary_ConstPressure>,
+        &ModelSolver01_06::reservoirResponse<Complex, Boundary_ConstPressure>
+    };
+    int index = (int)type;
+    if (index < 0 || index >= (int)(sizeof(table) / sizeof(table[0]))) index = 0;
+    return table[index];
 }
 
 // 拉普拉斯空间下的复合模型总函数 (包含井储和表皮)
-double ModelSolver01_06::flaplace_composite(double z, const QMap<QString, double>& p) {
-    double kf = p.value("kf");
-    double km = p.value("km");
-    double LfD = p.value("LfD");
-    double rmD = p.value("rmD");
-    double reD = p.value("reD", 0.0);
-    double omga1 = p.value("omega1");
-    double omga2 = p.value("omega2");
-    double remda1 = p.value("lambda1");
-    int nf = (int)p.value("nf", 4);
+template <typename T, ModelSolver01_06::BoundaryType BT, bool HasStorage>
+T ModelSolver01_06::flaplace_composite(T z, const ModelParams& p) {
+    T pf = reservoirResponse<T, BT>(z, p);
+    if constexpr (HasStorage) {
+        pf = applyWellboreStorage(z, pf, p);
+    }
+    return pf;
+}
+
+// 不含井储与表皮的储层响应 (只依赖储层参数)
+template <typename T, ModelSolver01_06::BoundaryType BT>
+T ModelSolver01_06::reservoirResponse(T z, const ModelParams& p) {
+    double kf = p[ModelParams::Kf];
+    double km = p[ModelParams::Km];
+    double LfD = p[ModelParams::LfD];
+    double rmD = p[ModelParams::RmD];
+    double reD = p[ModelParams::ReD];
+    double omga1 = p[ModelParams::Omega1];
+    double omga2 = p[ModelParams::Omega2];
+    double remda1 = p[ModelParams::Lambda1];
+    int nf = (int)p[ModelParams::Nf];
     if(nf < 1) nf = 1;
 
     double M12 = kf / km;
 
-    // 生成裂缝位置 xwD
-    QVector<double> xwD;
-    if (nf == 1) {
-        xwD.append(0.0);
-    } else {
-        double start = -0.9;
-        double end = 0.9;
-        double step = (end - start) / (nf - 1);
-        for(int i=0; i<nf; ++i) xwD.append(start + i * step);
-    }
+    // 线程局部工作区: 裂缝位置与方程组缓冲区在同一线程的各次拉普拉斯求值间复用
+    SolverWorkspace& ws = SolverWorkspace::local();
 
     double temp = omga2;
-    double fs1 = omga1 + remda1 * temp / (remda1 + z * temp);
-    double fs2 = M12 * temp;
+    T fs1 = omga1 + remda1 * temp / (remda1 + z * temp);
+    T fs2 = M12 * temp;
 
-    // 计算不含井储的拉普拉斯空间压力
-    double pf = PWD_composite(z, fs1, fs2, M12, LfD, rmD, reD, nf, xwD, m_type);
+    // 计算不含井储的拉普拉斯空间压力 (给定裂缝几何时按几何中的裂缝段计算，忽略 nf 与 LfD)
+    const FractureGeometry* geometry = (p.geometry && !p.geometry->isEmpty()) ? p.geometry.data() : nullptr;
+    return PWD_composite<T, BT>(z, fs1, fs2, M12, LfD, rmD, reD, nf, geometry, p.quadratureTolerance, p.quadratureMaxDepth, ws);
+}
 
-    // 加入井储和表皮效应
-    bool hasStorage = (m_type == Model_1 || m_type == Model_3 || m_type == Model_5);
-    if (hasStorage) {
-        double CD = p.value("cD", 0.0);
-        double S = p.value("S", 0.0);
-        if (CD > 1e-12 || std::abs(S) > 1e-12) {
-            pf = (z * pf + S) / (z + CD * z * z * (z * pf + S));
-        }
+// 加入井储和表皮效应
+template <typename T>
+T ModelSolver01_06::applyWellboreStorage(T z, T pf, const ModelParams& p) {
+    double CD = p[ModelParams::CD];
+    double S = p[ModelParams::S];
+    if (CD > 1e-12 || std::abs(S) > 1e-12) {
+        pf = (z * pf + S) / (z + CD * z * z * (z * pf + S));
     }
-
     return pf;
 }
 
 // 核心点源解叠加计算
-double ModelSolver01_06::PWD_composite(double z, double fs1, double fs2, double M12, double LfD, double rmD, double reD, int nf, const QVector<double>& xwD, ModelType type) {
-    using namespace boost::math;
-    QVector<double> ywD(nf, 0.0); // 假设裂缝在y方向无偏移
-    double gama1 = sqrt(z * fs1);
-    double gama2 = sqrt(z * fs2);
-    double arg_g2_rm = gama2 * rmD;
-    double arg_g1_rm = gama1 * rmD;
-
-    double k0_g2 = cyl_bessel_k(0, arg_g2_rm);
-    double k1_g2 = cyl_bessel_k(1, arg_g2_rm);
-    double k0_g1 = cyl_bessel_k(0, arg_g1_rm);
-    double k1_g1 = cyl_bessel_k(1, arg_g1_rm);
-
-    double term_mAB_i0 = 0.0;
-    double term_mAB_i1 = 0.0;
-
-    bool isInfinite = (type == Model_1 || type == Model_2);
-    bool isClosed = (type == Model_3 || type == Model_4);
-    bool isConstP = (type == Model_5 || type == Model_6);
-
-    // 边界条件处理
-    if (!isInfinite) {
-        double arg_re = gama2 * reD;
-        double i1_re_s = scaled_besseli(1, arg_re);
-        double i0_re_s = scaled_besseli(0, arg_re);
-        double k1_re = cyl_bessel_k(1, arg_re);
-        double k0_re = cyl_bessel_k(0, arg_re);
-        double i0_g2_s = scaled_besseli(0, arg_g2_rm);
-        double i1_g2_s = scaled_besseli(1, arg_g2_rm);
-
-        if (isClosed) {
-            if (i1_re_s > 1e-100) {
-                term_mAB_i0 = (k1_re / i1_re_s) * i0_g2_s * std::exp(arg_g2_rm - arg_re);
-                term_mAB_i1 = (k1_re / i1_re_s) * i1_g2_s * std::exp(arg_g2_rm - arg_re);
-            }
-        } else if (isConstP) {
-            if (i0_re_s > 1e-100) {
-                term_mAB_i0 = -(k0_re / i0_re_s) * i0_g2_s * std::exp(arg_g2_rm - arg_re);
-                term_mAB_i1 = -(k0_re / i0_re_s) * i1_g2_s * std::exp(arg_g2_rm - arg_re);
-            }
+template <typename T, ModelSolver01_06::BoundaryType BT>
+T ModelSolver01_06::PWD_composite(T z, T fs1, T fs2, double M12, double LfD, double rmD, double reD, int nf,
+                                  const FractureGeometry* geometry, double quadTolerance, int quadMaxDepth, SolverWorkspace& ws) {
+    // 裂缝段位置与半长: 未给定几何时为等间距、等长且在y方向无偏移的原布置
+    if (geometry) nf = geometry->size();
+    const QVector<double>& xwD = geometry ? geometry->x() : ws.fractureX(nf);
+    const QVector<double>& ywD = geometry ? geometry->y() : ws.fractureY(nf);
+    const double* halfLengths = geometry ? geometry->halfLength().constData() : nullptr;
+    auto halfLengthOf = [&](int j) { return halfLengths ? halfLengths[j] : LfD; };
+    WorkspaceBuffers<T>& buf = ws.buffers<T>();
+    T gama1 = std::sqrt(z * fs1);
+    T gama2 = std::sqrt(z * fs2);
+    T arg_g2_rm = gama2 * rmD;
+    T arg_g1_rm = gama1 * rmD;
+
+    // 界面与外边界处的 Bessel 函数一次批量求值: [γ2·rmD, γ1·rmD, γ2·reD]
+    const int nArgs = (BT != Boundary_Infinite) ? 3 : 2;
+    T args[3] = { arg_g2_rm, arg_g1_rm, gama2 * reD };
+    T bk0[3], bk1[3], bi0e[3], bi1e[3];
+    besselValues(args, nArgs, bk0, bk1, bi0e, bi1e);
+
+    T k0_g2 = bk0[0];
+    T k1_g2 = bk1[0];
+    T k0_g1 = bk0[1];
+    T k1_g1 = bk1[1];
+
+    T term_mAB_i0 = 0.0;
+    T term_mAB_i1 = 0.0;
+
+    // 边界条件处理: 无限大边界不含外边界项；封闭边界只需 K1/I1，定压边界只需 K0/I0
+    if constexpr (BT != Boundary_Infinite) {
+        T arg_re = args[2];
+        T i0_g2_s = bi0e[0];
+        T i1_g2_s = bi1e[0];
+
+        constexpr bool closed = (BT == Boundary_Closed);
+        constexpr double sign = closed ? 1.0 : -1.0;
+        T k_re = closed ? bk1[2] : bk0[2];
+        T i_re_s = closed ? bi1e[2] : bi0e[2];
+
+        if (std::abs(i_re_s) > 1e-100) {
+            T factor = sign * (k_re / i_re_s) * std::exp(arg_g2_rm - arg_re);
+            term_mAB_i0 = factor * i0_g2_s;
+            term_mAB_i1 = factor * i1_g2_s;
         }
     }
 
-    double term1 = term_mAB_i0 + k0_g2;
-    double term2 = term_mAB_i1 - k1_g2;
+    T term1 = term_mAB_i0 + k0_g2;
+    T term2 = term_mAB_i1 - k1_g2;
+
+    T Acup = M12 * gama1 * k1_g1 * term1 + gama2 * k0_g1 * term2;
 
-    double Acup = M12 * gama1 * k1_g1 * term1 + gama2 * k0_g1 * term2;
+    T i1_g1_s = bi1e[1];
+    T i0_g1_s = bi0e[1];
 
-    double i1_g1_s = scaled_besseli(1, arg_g1_rm);
-    double i0_g1_s = scaled_besseli(0, arg_g1_rm);
+    T Acdown_scaled = M12 * gama1 * i1_g1_s * term1 - gama2 * i0_g1_s * term2;
 
-    double Acdown_scaled = M12 * gama1 * i1_g1_s * term1 - gama2 * i0_g1_s * term2;
+    if (std::abs(Acdown_scaled) < 1e-100) Acdown_scaled = T(1e-100);
 
-    if (std::abs(Acdown_scaled) < 1e-100) Acdown_scaled = 1e-100;
+    T Ac_prefactor = Acup / Acdown_scaled;
 
-    double Ac_prefactor = Acup / Acdown_scaled;
+    // 裂缝 j (半长 Lf) 在裂缝 i 中心处的影响系数 (沿裂缝 j 积分，dx、dy 为 i 与 j 中心之差)
+    auto influence = [&](double dx, double dy, double Lf) -> T {
+        // 共线裂缝: 使用 Ki1 闭式线源积分, I0 项在指数因子可忽略时直接跳过
+        if (std::abs(dy) < 1e-14) {
+            T val = segmentK0(gama1, dx - Lf, dx + Lf);
+            if (std::real(gama1 * (std::abs(dx) + Lf) - arg_g1_rm) > -700.0) {
+                val += Ac_prefactor * segmentI0Scaled(gama1, dx - Lf, dx + Lf, arg_g1_rm);
+            }
+            return z * val / (M12 * z * 2.0 * Lf);
+        }
+
+        // 复数参数: 沿裂缝分段 15 点 Gauss-Legendre 积分，逐点求值复数 Bessel 函数
+        if constexpr (!std::is_same<T, double>::value) {
+            const int panels = 8;
+            T val = 0.0;
+            for (int p = 0; p < panels; ++p) {
+                double a0 = -Lf + 2.0 * Lf * p / panels, a1 = -Lf + 2.0 * Lf * (p + 1) / panels;
+                double x[15];
+                T f[15];
+                gaussNodes(a0, a1, x);
+                for (int k = 0; k < 15; ++k) {
+                    T arg = gama1 * std::sqrt((dx - x[k]) * (dx - x[k]) + dy * dy);
+                    T k0, k1, i0e, i1e;
+                    besselValues(&arg, 1, &k0, &k1, &i0e, &i1e);
+                    T exponent = arg - arg_g1_rm;
+                    f[k] = k0 + ((exponent.real() > -700.0) ? Ac_prefactor * i0e * std::exp(exponent) : T(0.0));
+                }
+                val += gaussSum(f, a0, a1);
+            }
+            return z * val / (M12 * z * 2.0 * Lf);
+        } else {
+
+        // 按积分节点块批量求值 K0 与缩放 I0
+        auto integrand = [&](const double* a, double* f, int n) {
+            double argDist[kGaussBlockMax] = {}, k0[kGaussBlockMax], i0e[kGaussBlockMax];
+            for (int k = 0; k < n; ++k) {
+                double arg = gama1 * std::sqrt((dx - a[k]) * (dx - a[k]) + dy * dy);
+                argDist[k] = (arg < 1e-10) ? 1e-10 : arg;
+            }
+            SOLVER_STATS_ADD(besselCalls, n);
+            BesselBatch::evaluate(argDist, n, k0, nullptr, i0e, nullptr);
+            for (int k = 0; k < n; ++k) {
+                double exponent = argDist[k] - arg_g1_rm;
+                double term2 = (exponent > -700.0) ? Ac_prefactor * i0e[k] * std::exp(exponent) : 0.0;
+                f[k] = k0[k] + term2;
+            }
+        };
+        // 沿裂缝积分
+        double val = adaptiveGauss(integrand, -Lf, Lf, quadTolerance, 0, quadMaxDepth);
+        return z * val / (M12 * z * 2.0 * Lf);
+        }
+    };
+
+    // 等间距共线裂缝: 系数只与 |i-j| 有关 (对称 Toeplitz 矩阵)，只需计算 nf 个积分并用 Levinson 递推求解
+    if (geometry ? geometry->isUniform() : (nf > 1 && isUniformLayout(xwD, ywD))) {
+        double step = xwD[1] - xwD[0];
+        double Lf = halfLengthOf(0);
+        SolverWorkspace::ensureSize(buf.col, nf);
+        for (int k = 0; k < nf; ++k) {
+            buf.col[k] = influence(k * step, 0.0, Lf);
+        }
+        // A*q = p*1, z*sum(q) = 1  =>  q = p*y (T*y = 1), p = 1 / (z*sum(y))
+        SolverWorkspace::ensureSize(buf.rhs, nf);
+        buf.rhs.fill(T(1.0));
+        SOLVER_STATS_ADD(linearSolves, 1);
+        if (solveSymmetricToeplitz(buf.col, buf.rhs, buf.x, buf.y, buf.tmp)) {
+            T sumY = 0.0;
+            for (const T& v : buf.x) sumY += v;
+            if (std::abs(sumY) > 1e-300) return T(1.0) / (z * sumY);
+        }
+        // 递推失败 (主子式奇异)，退回一般稠密求解
+    }
+
+    // 裂缝段很多时: 影响矩阵远场块 ACA 低秩压缩 (H 矩阵)，GMRES 求解 A*y = 1，p = 1 / (z*sum(y))；
+    // 压缩收益很小 (近场块占多数) 或不收敛 (裂缝段严重重叠等病态布置) 时将 H 矩阵展开后稠密求解，不再重复求值影响系数
+    // (H 矩阵与 GMRES 缓冲每次求值重新分配，不使用工作区，见 solverworkspace.h)
+    HMatrix<T> hmat;
+    bool compressed = false;
+    if (nf > kHMatrixMinSegments) {
+        QVector<double> radius(nf);
+        for (int j = 0; j < nf; ++j) radius[j] = halfLengthOf(j);
+        typename HMatrix<T>::Options options;
+        options.acaTolerance = kHMatrixAcaTolerance;
+        hmat.build(xwD, ywD, radius, [&](int i, int j) {
+            return influence(xwD[i] - xwD[j], ywD[i] - ywD[j], halfLengthOf(j));
+        }, options);
+        compressed = true;
+        if (hmat.evaluatedEntries() <= kHMatrixMaxEvaluatedFraction * nf * nf) {
+            typename HMatrix<T>::Vector ones = HMatrix<T>::Vector::Ones(nf);
+            typename HMatrix<T>::Vector y = HMatrix<T>::Vector::Zero(nf);
+            SOLVER_STATS_ADD(linearSolves, 1);
+            if (hmat.solve(ones, y, kHMatrixSolveTolerance)) {
+                T sumY = y.sum();
+                if (std::abs(sumY) > 1e-300) return T(1.0) / (z * sumY);
+            }
+        }
+    }
 
-    // 建立线性方程组求解裂缝各段流量分布
+    // 建立线性方程组求解裂缝各段流量分布 (矩阵与分解使用工作区缓冲区，大小不变时不再分配)
     int size = nf + 1;
-    Eigen::MatrixXd A_mat(size, size);
-    Eigen::VectorXd b_vec(size);
+    auto& A_mat = buf.A;
+    auto& b_vec = buf.b;
+    SolverWorkspace::ensureSize(A_mat, size, size);
+    SolverWorkspace::ensureSize(b_vec, size, 1);
+    SolverWorkspace::ensureSize(buf.sol, size, 1);
     b_vec.setZero();
     b_vec(nf) = 1.0; // 定产条件
 
-    for (int i = 0; i < nf; ++i) {
-        for (int j = 0; j < nf; ++j) {
-            auto integrand = [&](double a) -> double {
-                double dist = std::sqrt(std::pow(xwD[i] - xwD[j] - a, 2) + std::pow(ywD[i] - ywD[j], 2));
-                double arg_dist = gama1 * dist;
-                if (arg_dist < 1e-10) arg_dist = 1e-10;
-
-                double term2 = 0.0;
-                double exponent = arg_dist - arg_g1_rm;
-                if (exponent > -700.0) {
-                    term2 = Ac_prefactor * scaled_besseli(0, arg_dist) * std::exp(exponent);
-                }
-                return cyl_bessel_k(0, arg_dist) + term2;
-            };
-            // 沿裂缝积分
-            double val = adaptiveGauss(integrand, -LfD, LfD, 1e-5, 0, 10);
-            A_mat(i, j) = z * val / (M12 * z * 2 * LfD);
+    if (compressed) {
+        A_mat.topLeftCorner(nf, nf) = hmat.toDense();
+    } else {
+        for (int i = 0; i < nf; ++i) {
+            for (int j = 0; j < nf; ++j) {
+                A_mat(i, j) = influence(xwD[i] - xwD[j], ywD[i] - ywD[j], halfLengthOf(j));
+            }
         }
     }
     // 补充方程：各裂缝压力相等，流量和为1
@@ -301,47 +1335,94 @@ double ModelSolver01_06::PWD_composite(double z, double fs1, double fs2, double
     }
     A_mat(nf, nf) = 0.0;
 
-    return A_mat.fullPivLu().solve(b_vec)(nf);
+    SOLVER_STATS_ADD(linearSolves, 1);
+    buf.lu.compute(A_mat);
+    buf.sol = buf.lu.solve(b_vec);
+    return buf.sol(nf);
 }
 
-// 缩放的贝塞尔 I 函数 I(x)*exp(-x)，防止溢出
-double ModelSolver01_06::scaled_besseli(int v, double x) {
-    if (x < 0) x = -x;
-    if (x > 600.0) return 1.0 / std::sqrt(2.0 * M_PI * x);
-    return boost::math::cyl_bessel_i(v, x) * std::exp(-x);
+// 判断裂缝是否等间距分布在同一条直线上 (影响矩阵为 Toeplitz 结构)
+bool ModelSolver01_06::isUniformLayout(const QVector<double>& xwD, const QVector<double>& ywD) {
+    int n = xwD.size();
+    if (n < 2 || ywD.size() != n) return false;
+    double step = xwD[1] - xwD[0];
+    double tol = 1e-12 * std::max(1.0, std::abs(step));
+    for (int i = 1; i < n; ++i) {
+        if (std::abs((xwD[i] - xwD[i - 1]) - step) > tol) return false;
+        if (std::abs(ywD[i] - ywD[0]) > tol) return false;
+    }
+    return true;
 }
 
-// 高斯积分点
-double ModelSolver01_06::gauss15(std::function<double(double)> f, double a, double b) {
-    static const double X[] = { 0.0, 0.201194, 0.394151, 0.570972, 0.724418, 0.848207, 0.937299, 0.987993 };
-    static const double W[] = { 0.202578, 0.198431, 0.186161, 0.166269, 0.139571, 0.107159, 0.070366, 0.030753 };
-    double h = 0.5 * (b - a); double c = 0.5 * (a + b); double s = W[0] * f(c);
-    for (int i = 1; i < 8; ++i) { double dx = h * X[i]; s += W[i] * (f(c - dx) + f(c + dx)); }
-    return s * h;
+// Levinson 递推求解对称 Toeplitz 方程组 T*x = b (col 为 T 的第一列), O(n^2)；y、tmp 为调用方提供的递推中间向量
+template <typename T>
+bool ModelSolver01_06::solveSymmetricToeplitz(const QVector<T>& col, const QVector<T>& b, QVector<T>& x, QVector<T>& y, QVector<T>& tmp) {
+    int n = col.size();
+    SolverWorkspace::ensureSize(x, n);
+    if (n == 0 || std::abs(col[0]) < 1e-300) return false;
+
+    // 归一化为单位对角
+    T r0 = col[0];
+    SolverWorkspace::ensureSize(y, n);
+    SolverWorkspace::ensureSize(tmp, n);
+    y.fill(T(0.0));
+    tmp.fill(T(0.0));
+    x[0] = b[0] / r0;
+    if (n == 1) return true;
+
+    y[0] = -col[1] / r0;
+    T alpha = y[0];
+    T beta = 1.0;
+
+    for (int k = 1; k < n; ++k) {
+        beta *= (1.0 - alpha * alpha);
+        if (std::abs(beta) < 1e-14) return false;
+
+        T s = b[k] / r0;
+        for (int i = 0; i < k; ++i) s -= (col[i + 1] / r0) * x[k - 1 - i];
+        T mu = s / beta;
+        for (int i = 0; i < k; ++i) tmp[i] = x[i] + mu * y[k - 1 - i];
+        for (int i = 0; i < k; ++i) x[i] = tmp[i];
+        x[k] = mu;
+
+        if (k < n - 1) {
+            T a = -col[k + 1] / r0;
+            for (int i = 0; i < k; ++i) a -= (col[i + 1] / r0) * y[k - 1 - i];
+            alpha = a / beta;
+            for (int i = 0; i < k; ++i) tmp[i] = y[i] + alpha * y[k - 1 - i];
+            for (int i = 0; i < k; ++i) y[i] = tmp[i];
+            y[k] = alpha;
+        }
+    }
+    return true;
 }
 
-// 自适应高斯积分
-double ModelSolver01_06::adaptiveGauss(std::function<double(double)> f, double a, double b, double eps, int depth, int maxDepth) {
-    double c = (a + b) / 2.0; double v1 = gauss15(f, a, b); double v2 = gauss15(f, a, c) + gauss15(f, c, b);
-    if (depth >= maxDepth || std::abs(v1 - v2) < 1e-10 * std::abs(v2) + eps) return v2;
-    return adaptiveGauss(f, a, c, eps/2, depth+1, maxDepth) + adaptiveGauss(f, c, b, eps/2, depth+1, maxDepth);
+// 高斯积分点 (15 个节点一次批量求值)
+template <typename F>
+double ModelSolver01_06::gauss15(const F& f, double a, double b) {
+    double x[15], fx[15];
+    gaussNodes(a, b, x);
+    f(x, fx, 15);
+    return gaussSum(fx, a, b);
 }
 
-// Stehfest 系数
-double ModelSolver01_06::stefestCoefficient(int i, int N) {
-    double s = 0.0; int k1 = (i + 1) / 2; int k2 = std::min(i, N / 2);
-    for (int k = k1; k <= k2; ++k) {
-        double num = pow(k, N / 2.0) * factorial(2 * k);
-        double den = factorial(N / 2 - k) * factorial(k) * factorial(k - 1) * factorial(i - k) * factorial(2 * k - i);
-        if(den!=0) s += num/den;
-    }
-    return ((i + N / 2) % 2 == 0 ? 1.0 : -1.0) * s;
+// 自适应高斯积分
+template <typename F>
+double ModelSolver01_06::adaptiveGauss(const F& f, double a, double b, double eps, int depth, int maxDepth) {
+    return adaptiveGaussStep(f, a, b, gauss15(f, a, b), eps, depth, maxDepth);
 }
 
-// 阶乘
-double ModelSolver01_06::factorial(int n) {
-    if(n<=1)return 1;
-    double r=1;
-    for(int i=2;i<=n;++i) r*=i;
-    return r;
+// 自适应递推: whole 为上一层已得到的整段估计，两个半区间的 30 个节点合并为一次批量求值
+template <typename F>
+double ModelSolver01_06::adaptiveGaussStep(const F& f, double a, double b, double whole, double eps, int depth, int maxDepth) {
+    SOLVER_STATS_ADD(quadratureSubdivisions, 1);
+    SOLVER_STATS_MAX(maxQuadratureDepth, depth + 1);
+    double c = (a + b) / 2.0;
+    double x[30], fx[30];
+    gaussNodes(a, c, x); gaussNodes(c, b, x + 15);
+    f(x, fx, 30);
+    double left = gaussSum(fx, a, c), right = gaussSum(fx + 15, c, b);
+    double v2 = left + right;
+    if (depth >= maxDepth || std::abs(whole - v2) < 1e-10 * std::abs(v2) + eps) return v2;
+    return adaptiveGaussStep(f, a, c, left, eps/2, depth+1, maxDepth) + adaptiveGaussStep(f, c, b, right, eps/2, depth+1, maxDepth);
 }
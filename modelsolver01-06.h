@@ -13,12 +13,39 @@
 #include <QMap>
 #include <QVector>
 #include <QString>
+#include <QByteArray>
 #include <tuple>
+#include <complex>
 #include <functional>
+#include "modelparams.h"
+#include "laplaceinversion.h"
+#include "solverstats.h"
+
+class QThreadPool;
+class SolverWorkspace;
 
 // 类型定义: <时间, 压力, 导数>
 using ModelCurveData = std::tuple<QVector<double>, QVector<double>, QVector<double>>;
 
+// 单次计算选项: 随调用传入，求解器不保存可变状态，同一实例可被多个线程同时调用
+struct SolverOptions {
+    bool highPrecision = true;        // false 时使用低阶 Stehfest (N=4) 快速计算 (旧接口；按精度档位设置选项见 accuracyprofile.h)
+    int stehfestN = 0;                // Stehfest 阶数，<=0 表示使用参数块中的 N
+    int stehfestMaxN = 0;             // >stehfestN 时启用逐点自适应阶数: 从 stehfestN 起每次加 2，直到相邻两阶的差连续两步缩小并满足 stehfestTolerance
+    double stehfestTolerance = 1e-6;  // 自适应阶数的收敛判据: 相邻两阶 pD 与导数的相对差均不超过该值
+    bool laplaceInterpolation = true; // 拉普拉斯空间插值模式: 对 p(z) 做 Chebyshev 插值后再反演，减少拉普拉斯求值次数 (仅 Stehfest；插值容差按阶数收紧，高阶时达不到则直接求值)
+    InversionMethod inversion = InversionMethod::Stehfest; // 数值反演方法 (Talbot/de Hoog/Euler 使用复数参数核函数)
+    int inversionOrder = 0;           // 非 Stehfest 方法的阶数，<=0 表示按 highPrecision 取默认阶数
+    bool typeCurveCache = false;      // 典型曲线缓存模式: 无因次参数不变时由缓存的 pD(tD) 曲线插值，物理参数只做平移与缩放
+    double coarseGridTolerance = 0.0; // >0 时启用粗网格模式: 请求点很多时在自适应加密的对数网格上求解，再按双对数单调三次插值映射，插值相对误差不超过该值
+    bool reservoirCache = false;      // 储层响应缓存模式: 缓存井储与表皮之前的拉普拉斯空间储层响应，只修改 cD、S、gamaD 或压力缩放参数时无需重新求解裂缝影响矩阵
+    double quadratureTolerance = 1e-5; // 非共线裂缝影响系数自适应高斯积分的容差
+    int quadratureMaxDepth = 10;      // 自适应高斯积分的最大递归深度
+    double gridDensity = 1.0;         // 典型曲线网格与粗网格初始网格的密度 (相对默认每周期点数的倍数)
+    double asymptoticTolerance = 0.0; // >0 时启用渐近段捷径: 极早期与极晚期的幂律段经完整反演验证后按闭式给出，相对误差不超过该值
+    SolverStats* stats = nullptr;     // 非空时把本次计算的计数与各阶段耗时累加到该记录 (可多线程共用，合并时加锁)
+};
+
 class ModelSolver01_06
 {
 public:
@@ -32,15 +59,51 @@ public:
         Model_6      // 定压边界 + 恒定井储
     };
 
+    // 外边界类型 (各模型核函数按边界类型与井储条件在编译期特化)
+    enum BoundaryType {
+        Boundary_Infinite = 0, // 无限大
+        Boundary_Closed,       // 封闭
+        Boundary_ConstPressure // 定压
+    };
+
+    // 拉普拉斯空间核函数: p(z)，及复数参数版本 (供复平面反演方法使用)
+    using LaplaceKernel = double (*)(double z, const ModelParams& p);
+    using ComplexLaplaceKernel = std::complex<double> (*)(std::complex<double> z, const ModelParams& p);
+
     // 构造函数
     explicit ModelSolver01_06(ModelType type);
     virtual ~ModelSolver01_06();
 
-    // 设置计算精度
-    void setHighPrecision(bool high);
+    // 时间点并行计算的最大线程数 (全局设置，<=0 表示使用 CPU 核心数)
+    static void setMaxThreadCount(int count);
+    static int maxThreadCount();
+
+    // 作用域内当前线程发起的求解按时间点串行执行 (外层已按任务并行时使用，如雅可比扰动求解，避免两层并行叠加)
+    class SerialScope
+    {
+    public:
+        SerialScope();
+        ~SerialScope();
+    private:
+        bool m_previous;
+        Q_DISABLE_COPY(SerialScope)
+    };
 
-    // 核心计算接口：根据参数和时间序列计算理论曲线
-    ModelCurveData calculateTheoreticalCurve(const QMap<QString, double>& params, const QVector<double>& providedTime = QVector<double>());
+    // 核心计算接口：根据参数和时间序列计算理论曲线 (可重入，精度等选项按调用传入)
+    ModelCurveData calculateTheoreticalCurve(const QMap<QString, double>& params, const QVector<double>& providedTime = QVector<double>(),
+                                             const SolverOptions& options = SolverOptions()) const;
+    // 同上，直接使用已转换的参数块 (拟合等高频调用场景，避免字符串查找)
+    ModelCurveData calculateTheoreticalCurve(const ModelParams& params, const QVector<double>& providedTime = QVector<double>(),
+                                             const SolverOptions& options = SolverOptions()) const;
+
+    // 批量计算接口: 在同一时间序列上计算多组参数的理论曲线 (敏感性分析等)，结果与参数组一一对应；
+    // 时间序列与反演引擎只准备一次，(参数组 × 时间点) 的反演任务统一分发到线程池
+    QVector<ModelCurveData> calculateTheoreticalCurves(const QVector<ModelParams>& paramSets, const QVector<double>& providedTime = QVector<double>(),
+                                                       const SolverOptions& options = SolverOptions()) const;
+
+    // 获取模型对应的特化核函数 (分派表)
+    static LaplaceKernel kernelFor(ModelType type);
+    static ComplexLaplaceKernel complexKernelFor(ModelType type);
 
     // 获取模型名称（静态辅助函数）
     static QString getModelName(ModelType type);
@@ -48,28 +111,158 @@ public:
     // 生成对数时间步长（静态辅助函数，供内部或外部生成时间序列使用）
     static QVector<double> generateLogTimeSteps(int count, double startExp, double endExp);
 
+    // 典型曲线缓存 (SolverOptions::typeCurveCache) 的代价判断: 两组参数是否共用同一条无因次典型曲线
+    // (只差平移 tD、缩放压力的参数)，以及在时间 t 上未命中时新建典型曲线要求解的网格点数
+    static bool sharesTypeCurve(ModelType type, const ModelParams& a, const ModelParams& b, const SolverOptions& options);
+    static int typeCurveGridPoints(const ModelParams& params, const QVector<double>& t, const SolverOptions& options);
+
 private:
-    // 计算无因次压力和导数
-    void calculatePDandDeriv(const QVector<double>& tD, const QMap<QString, double>& params,
-                             std::function<double(double, const QMap<QString, double>&)> laplaceFunc,
-                             QVector<double>& outPD, QVector<double>& outDeriv);
+    // z*p(z) 关于 ln z 的 Chebyshev 插值 (Chebyshev-Lobatto 节点)
+    struct LaplaceInterpolant {
+        QVector<double> nodes;   // ln z 节点
+        QVector<double> values;  // 节点处的 ln(z*p) 或 z*p
+        bool useLog = true;
+        double eval(double z) const;
+    };
+
+    static const int kInterpMinNodes = 33;
+    static const int kInterpMaxNodes = 129;
+    // 插值误差经 Stehfest 交错求和放大约 Σ|V_m| 倍 (N=8 约 1e4，N=16 约 1e6)，因此插值容差取
+    // kInterpErrorBudget / Σ|V_m| (按阶数上限)，使插值对反演结果的贡献不超过该值；容差低于
+    // kInterpMinTolerance (节点数上限内达不到) 时不插值
+    static constexpr double kInterpErrorBudget = 1e-6;
+    static constexpr double kInterpMinTolerance = 1e-13;
+
+    // Stehfest 自适应阶数: p(z) 的相对误差 (双精度舍入) 及判定相邻两阶差值已处于舍入噪声水平的倍数
+    static constexpr double kStehfestValueError = 2.2e-16;
+    static constexpr double kStehfestNoiseFactor = 10.0;
+
+    // 典型曲线网格密度 (每个对数周期的点数)
+    static const int kTypeCurvePointsPerDecade = 24;
 
-    // 拉普拉斯空间下的复合模型函数
-    double flaplace_composite(double z, const QMap<QString, double>& p);
+    // 粗网格模式: 请求点数超过 kCoarseGridMinPoints 时启用，初始网格每个对数周期 kCoarseGridPointsPerDecade 点，
+    // 加密后的网格点数不超过 kCoarseGridMaxPoints (且不超过请求点数的一半)
+    static const int kCoarseGridMinPoints = 200;
+    static const int kCoarseGridPointsPerDecade = 8;
+    static const int kCoarseGridMaxPoints = 2000;
+
+    // 渐近段捷径: 单条曲线的请求点数不少于 kAsymptoticMinPoints 时才查找 (探测本身需要若干次完整反演)
+    static const int kAsymptoticMinPoints = 48;
+
+    // 裂缝段数超过 kHMatrixMinSegments (且不是等间距等长布置) 时使用 H 矩阵 + GMRES，远场块 ACA 截断误差为
+    // kHMatrixAcaTolerance，迭代相对残差为 kHMatrixSolveTolerance (迭代很便宜，取得更严使解的误差由截断误差决定)；
+    // 实际求值的元素超过 kHMatrixMaxEvaluatedFraction · nf² (压缩收益很小) 时不迭代，展开后直接稠密求解
+    static const int kHMatrixMinSegments = 64;
+    static constexpr double kHMatrixAcaTolerance = 1e-10;
+    static constexpr double kHMatrixSolveTolerance = 1e-12;
+    static constexpr double kHMatrixMaxEvaluatedFraction = 0.75;
+
+    // 储层响应缓存: 单次计算中的查表与新增值 (按储层参数分组)，写回缓存条目的横坐标数上限
+    struct ReservoirMemo;
+    static const int kReservoirCacheMaxAbscissae = 16384;
+
+    // 单条曲线的反演准备结果，同一曲线的各时间点共享 (只读)
+    struct InversionSetup {
+        const ModelParams* params = nullptr;
+        ReservoirMemo* memo = nullptr; // 为空时直接调用完整核函数
+        int N = 4;                 // Stehfest 起始阶数
+        int maxN = 4;              // 自适应阶数上限
+        bool useInterp = false;    // 是否由拉普拉斯插值给出 p(z)
+        double interpTolerance = 0.0; // 插值的相对误差上限 (useInterp 时有效)
+        LaplaceInterpolant interp;
+    };
+
+    // 批量计算的实际实现 (calculateTheoreticalCurves 在需要统计时为其设置活动记录并计时)
+    QVector<ModelCurveData> computeCurves(const QVector<ModelParams>& inputSets, const QVector<double>& providedTime,
+                                          const SolverOptions& options) const;
+
+    static QThreadPool* solverThreadPool();
+    static void runParallel(int count, const std::function<void(int)>& task);
+    static bool buildLaplaceInterpolant(double zMin, double zMax, double tolerance, const std::function<double(double)>& pbar,
+                                        LaplaceInterpolant& out);
+
+    // 按选项分派反演方法，计算各 tD 处的无因次压力和导数
+    void solveDimensionless(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                            QVector<double>& outPD, QVector<double>& outDeriv) const;
+    // 典型曲线缓存模式: 命中 (或新建) 覆盖 tD 范围的缓存曲线后插值，失败时返回 false
+    bool interpolateTypeCurve(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                              QVector<double>& outPD, QVector<double>& outDeriv) const;
+    // 粗网格模式: 在自适应对数网格上求解后插值到各 tD，请求点数不足、点数上限内未达到容差或网格构建失败时返回 false
+    bool solveOnCoarseGrid(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                           QVector<double>& outPD, QVector<double>& outDeriv) const;
+    // 缓存键: 模型类型、无因次参数与求解选项
+    static QByteArray typeCurveKey(ModelType type, const ModelParams& params, const SolverOptions& options);
+    // 覆盖 [tMin, tMax] 的典型曲线网格: 对数周期范围 [e0, e1] 与点数
+    static int typeCurveGrid(double tMin, double tMax, const SolverOptions& options, double& e0, double& e1);
+
+    // 物理时间换算为无因次时间 tD，以及无因次压力换算为压差的系数
+    static void dimensionlessTime(const ModelParams& params, const QVector<double>& t, QVector<double>& tD);
+    static double pressureCoefficient(const ModelParams& params);
+
+    // 按选项创建复平面反演引擎，Stehfest 返回空指针
+    static QSharedPointer<InversionEngine> createEngine(const SolverOptions& options);
+    // 反演准备: Stehfest 阶数范围与覆盖 tD 范围的拉普拉斯插值
+    void prepareInversion(const QVector<double>& tD, const ModelParams& params, const SolverOptions& options,
+                          ReservoirMemo* memo, InversionSetup& setup) const;
+    // 单个时间点的反演 (engine 为空时使用 Stehfest)，含压敏修正
+    void invertPoint(const InversionSetup& setup, const SolverOptions& options, const InversionEngine* engine,
+                     double t, double& outPD, double& outDeriv) const;
+    // 渐近段捷径: 在曲线两端查找并验证幂律段，段内各点按闭式给出；solved 标记已求出的点 (含探测时完整反演的点)，
+    // 其余点仍需逐点反演。返回按闭式给出的点数
+    int solveAsymptoticRegimes(const InversionSetup& setup, const SolverOptions& options, const InversionEngine* engine,
+                               const QVector<double>& tD, QVector<double>& outPD, QVector<double>& outDeriv,
+                               QVector<char>& solved) const;
+    // 储层响应缓存: 取出某储层参数组的缓存快照；缓存键只含储层参数，cD、S、gamaD 与压力缩放参数不参与
+    static QSharedPointer<ReservoirMemo> createReservoirMemo(const QByteArray& key);
+    static QByteArray reservoirKey(ModelType type, const ModelParams& params, bool complexAbscissae);
+    // 拉普拉斯空间求值 (实数/复数横坐标)，启用缓存时储层响应查表后再施加井储与表皮
+    double laplaceValue(const InversionSetup& setup, double z) const;
+    std::complex<double> laplaceValue(const InversionSetup& setup, std::complex<double> s) const;
+
+    // 压敏效应修正 pD' = -ln(1 - γ pD) / γ，导数按链式法则修正
+    static void applyPressureSensitivity(double gamaD, double& pd, double& deriv);
+
+    // 拉普拉斯空间下的复合模型函数 (按标量类型、边界类型与井储条件特化; T 为 double 或 std::complex<double>)
+    template <typename T, BoundaryType BT, bool HasStorage>
+    static T flaplace_composite(T z, const ModelParams& p);
+
+    // 不含井储与表皮的储层响应 (按标量类型与边界类型特化)，及其核函数表
+    template <typename T, BoundaryType BT>
+    static T reservoirResponse(T z, const ModelParams& p);
+    static LaplaceKernel reservoirKernelFor(ModelType type);
+    static ComplexLaplaceKernel complexReservoirKernelFor(ModelType type);
+    // 在储层响应上施加井储与表皮效应
+    template <typename T>
+    static T applyWellboreStorage(T z, T pf, const ModelParams& p);
 
     // 计算点源解的拉普拉斯变换值
-    double PWD_composite(double z, double fs1, double fs2, double M12, double LfD, double rmD, double reD, int nf, const QVector<double>& xwD, ModelType type);
+    template <typename T, BoundaryType BT>
+    static T PWD_composite(T z, T fs1, T fs2, double M12, double LfD, double rmD, double reD, int nf,
+                           const FractureGeometry* geometry, double quadTolerance, int quadMaxDepth, SolverWorkspace& ws);
+
+    // 等间距裂缝 (Toeplitz 影响矩阵) 的判断与快速求解
+    static bool isUniformLayout(const QVector<double>& xwD, const QVector<double>& ywD);
+    template <typename T>
+    static bool solveSymmetricToeplitz(const QVector<T>& col, const QVector<T>& b, QVector<T>& x, QVector<T>& y, QVector<T>& tmp);
 
     // 数学辅助函数
-    double scaled_besseli(int v, double x);
-    double gauss15(std::function<double(double)> f, double a, double b);
-    double adaptiveGauss(std::function<double(double)> f, double a, double b, double eps, int depth, int maxDepth);
-    double stefestCoefficient(int i, int N);
-    double factorial(int n);
+    // 块积分函数 f(a, fx, n): 一次计算 n 个节点 a[0..n) 处的被积函数值 fx[0..n) (n 不超过 kGaussBlockMax)；
+    // 以模板参数传入，避免构造 std::function
+    static constexpr int kGaussBlockMax = 30;
+    template <typename F>
+    static double gauss15(const F& f, double a, double b);
+    template <typename F>
+    static double adaptiveGauss(const F& f, double a, double b, double eps, int depth, int maxDepth);
+    template <typename F>
+    static double adaptiveGaussStep(const F& f, double a, double b, double whole, double eps, int depth, int maxDepth);
 
 private:
-    ModelType m_type;       // 当前模型类型
-    bool m_highPrecision;   // 高精度计算标志
+    ModelType m_type;       // 当前模型类型 (构造后不变)
+    LaplaceKernel m_kernel; // 当前模型的特化核函数 (构造后不变)
+    ComplexLaplaceKernel m_complexKernel; // 复数参数核函数 (构造后不变)
+    LaplaceKernel m_reservoirKernel;      // 不含井储与表皮的储层响应核函数 (构造后不变)
+    ComplexLaplaceKernel m_complexReservoirKernel;
+    bool m_hasStorage;                    // 是否施加井储与表皮 (变井储模型)
 };
 
 #endif // MODELSOLVER01_06_H  // 修改点：保持一致
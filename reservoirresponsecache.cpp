@@ -0,0 +1,26 @@
+/*
+ * reservoirresponsecache.cpp
+ * 文件作用: 拉普拉斯空间储层响应缓存实现
+ * 功能描述:
+ * 1. 以字节串键 (模型边界类型与储层参数的原始二进制) 索引储层响应。
+ * 2. 横坐标按二进制精确匹配: 相同 tD 生成的 Stehfest 节点、插值节点与复平面围道节点逐位相同。
+ */
+
+#include "reservoirresponsecache.h"
+
+#include <cstring>
+
+ReservoirResponse::Abscissa ReservoirResponse::abscissa(std::complex<double> z)
+{
+    double re = z.real(), im = z.imag();
+    quint64 a = 0, b = 0;
+    std::memcpy(&a, &re, sizeof(a));
+    std::memcpy(&b, &im, sizeof(b));
+    return qMakePair(a, b);
+}
+
+ReservoirResponseCache& ReservoirResponseCache::shared()
+{
+    static ReservoirResponseCache cache;
+    return cache;
+}
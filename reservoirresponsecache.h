@@ -0,0 +1,42 @@
+/*
+ * reservoirresponsecache.h
+ * 文件作用: 拉普拉斯空间储层响应缓存头文件
+ * 功能描述:
+ * 1. 缓存某组储层参数下、各拉普拉斯横坐标 z 处加入井储与表皮之前的储层响应 p̄(z)
+ *    (各裂缝影响矩阵求解的结果，求解器中最耗时的部分)。
+ * 2. 求解阶段的参数依赖: 储层响应只与储层参数 (渗透率比、裂缝、复合区、双重介质、边界) 有关；
+ *    井储与表皮 (cD、S) 在其后施加，压敏系数 gamaD 在反演之后修正，产量、体积系数、厚度只缩放结果。
+ *    只修改后者时横坐标与储层参数均不变，储层响应全部命中缓存，只需重算下游阶段。
+ *    渗透率、孔隙度、粘度、综合压缩系数与参考长度进入无因次时间 tD，修改后横坐标 z 随之改变，查表不会命中。
+ * 3. 条目以共享只读指针返回 (写时复制)，调用方在一次计算中新求得的值合并为新条目后整体替换，
+ *    并发读取无需加锁。全局共享、线程安全，按最近使用顺序淘汰 (LruCache)。
+ */
+
+#ifndef RESERVOIRRESPONSECACHE_H
+#define RESERVOIRRESPONSECACHE_H
+
+#include <QHash>
+#include <QPair>
+#include <complex>
+#include "lrucache.h"
+
+// 一组储层参数下的储层响应: 横坐标 z (实部与虚部的二进制) -> p̄(z)
+struct ReservoirResponse {
+    using Abscissa = QPair<quint64, quint64>;
+    QHash<Abscissa, std::complex<double>> values;
+
+    static Abscissa abscissa(std::complex<double> z);
+};
+
+// 储层响应缓存，容量按储层参数组计 (默认 16 组)
+class ReservoirResponseCache : public LruCache<ReservoirResponse>
+{
+public:
+    // 全局共享实例
+    static ReservoirResponseCache& shared();
+
+private:
+    ReservoirResponseCache() : LruCache<ReservoirResponse>(16) {}
+};
+
+#endif // RESERVOIRRESPONSECACHE_H
@@ -10,6 +10,7 @@
 
 #include "settingswidget.h"
 #include "ui_settingswidget.h"
+#include "accuracyprofile.h"
 #include <QDebug>
 #include <QDate>
 
@@ -67,6 +68,10 @@ void SettingsWidget::initInterface()
     ui->cmbRateUnit->clear();
     ui->cmbRateUnit->addItems({"m³/d (立方米/天)", "bbl/d (桶/天)", "t/d (吨/天)"});
 
+    ui->cmbModelAccuracy->clear();
+    ui->cmbModelAccuracy->addItem("预览 (快速)", (int)AccuracyProfile::Preview);
+    ui->cmbModelAccuracy->addItem("报告 (高精度)", (int)AccuracyProfile::Report);
+
     // 3. 初始化绘图背景
     ui->cmbPlotBackground->clear();
     ui->cmbPlotBackground->addItems({"白色主题 (默认)", "深色主题 (护眼)", "灰色网格"});
@@ -86,6 +91,9 @@ void SettingsWidget::loadSettings()
     ui->cmbPressureUnit->setCurrentIndex(m_settings->value("units/pressure", 0).toInt()); // 默认 MPa
     ui->cmbRateUnit->setCurrentIndex(m_settings->value("units/rate", 0).toInt());         // 默认 m3/d
     ui->spinPrecision->setValue(m_settings->value("units/precision", 4).toInt());         // 默认 4位小数
+    int accuracyIndex = ui->cmbModelAccuracy->findData(m_settings->value("solver/modelAccuracy", (int)AccuracyProfile::Report).toInt());
+    ui->cmbModelAccuracy->setCurrentIndex(accuracyIndex >= 0 ? accuracyIndex : ui->cmbModelAccuracy->count() - 1); // 默认报告档位
+    ui->spinSolverThreads->setValue(m_settings->value("solver/threadCount", 0).toInt());  // 默认按 CPU 核心数
 
     // --- 3. 绘图设置 ---
     ui->cmbPlotBackground->setCurrentIndex(m_settings->value("plot/background", 0).toInt());
@@ -123,6 +131,8 @@ void SettingsWidget::applySettings()
     m_settings->setValue("units/pressure", ui->cmbPressureUnit->currentIndex());
     m_settings->setValue("units/rate", ui->cmbRateUnit->currentIndex());
     m_settings->setValue("units/precision", ui->spinPrecision->value());
+    m_settings->setValue("solver/modelAccuracy", getModelAccuracyProfile());
+    m_settings->setValue("solver/threadCount", ui->spinSolverThreads->value());
 
     m_settings->setValue("plot/background", ui->cmbPlotBackground->currentIndex());
     m_settings->setValue("plot/showGrid", ui->chkShowGrid->isChecked());
@@ -243,5 +253,7 @@ bool SettingsWidget::isBackupEnabled() const { return ui->chkEnableBackup->isChe
 int SettingsWidget::getPressureUnitIndex() const { return ui->cmbPressureUnit->currentIndex(); }
 int SettingsWidget::getRateUnitIndex() const { return ui->cmbRateUnit->currentIndex(); }
 int SettingsWidget::getPrecision() const { return ui->spinPrecision->value(); }
+int SettingsWidget::getModelAccuracyProfile() const { return ui->cmbModelAccuracy->currentData().toInt(); }
+int SettingsWidget::getSolverThreadCount() const { return ui->spinSolverThreads->value(); }
 int SettingsWidget::getPlotBackgroundStyle() const { return ui->cmbPlotBackground->currentIndex(); }
 bool SettingsWidget::isGridVisibleDefault() const { return ui->chkShowGrid->isChecked(); }
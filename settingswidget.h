@@ -46,6 +46,8 @@ public:
     int getPressureUnitIndex() const; // 0: MPa, 1: psi
     int getRateUnitIndex() const;     // 0: m3/d, 1: bbl/d
     int getPrecision() const;         // 小数位数
+    int getModelAccuracyProfile() const; // 模型页计算精度档位 (AccuracyProfile 枚举值)
+    int getSolverThreadCount() const;    // 求解并行线程数 (0: 按 CPU 核心数)
 
     // 绘图配置 [新增]
     int getPlotBackgroundStyle() const; // 0: 白色, 1: 深色
@@ -0,0 +1,71 @@
+/*
+ * solverstats.cpp
+ * 文件作用: 求解器运行统计实现
+ * 功能描述:
+ * 1. 阶段计时 (线程局部活动记录及其设置与恢复在头文件中内联)。
+ * 2. 记录合并 (加锁) 与界面摘要文本。
+ */
+
+#include "solverstats.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <algorithm>
+
+namespace {
+QMutex g_mergeMutex;
+}
+
+void SolverStats::merge(const SolverStats& other)
+{
+    curves += other.curves;
+    laplaceEvaluations += other.laplaceEvaluations;
+    complexEvaluations += other.complexEvaluations;
+    besselCalls += other.besselCalls;
+    quadratureSubdivisions += other.quadratureSubdivisions;
+    maxQuadratureDepth = std::max(maxQuadratureDepth, other.maxQuadratureDepth);
+    linearSolves += other.linearSolves;
+    asymptoticPoints += other.asymptoticPoints;
+    typeCurveMs += other.typeCurveMs;
+    coarseGridMs += other.coarseGridMs;
+    prepareMs += other.prepareMs;
+    inversionMs += other.inversionMs;
+    totalMs += other.totalMs;
+}
+
+QString SolverStats::summary() const
+{
+    if (!compiledIn()) return QString("求解统计未编译 (WELLTEST_SOLVER_STATS)");
+    return QString("曲线 %1 条, 拉氏求值 %2 次 (复数 %3), Bessel %4 次, 积分细分 %5 次 (最大深度 %6), 方程组求解 %7 次, 渐近段 %8 点; "
+                   "耗时 %9 ms (典型曲线 %10, 粗网格 %11, 准备 %12, 反演 %13)")
+        .arg(curves).arg(laplaceEvaluations).arg(complexEvaluations).arg(besselCalls).arg(quadratureSubdivisions)
+        .arg(maxQuadratureDepth).arg(linearSolves).arg(asymptoticPoints)
+        .arg(totalMs, 0, 'f', 1).arg(typeCurveMs, 0, 'f', 1).arg(coarseGridMs, 0, 'f', 1)
+        .arg(prepareMs, 0, 'f', 1).arg(inversionMs, 0, 'f', 1);
+}
+
+bool SolverStats::compiledIn()
+{
+#ifdef WELLTEST_SOLVER_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+SolverStats::PhaseTimer::PhaseTimer(double SolverStats::*field) : m_stats(s_active), m_field(field)
+{
+    if (m_stats) m_timer.start();
+}
+
+SolverStats::PhaseTimer::~PhaseTimer()
+{
+    if (m_stats) m_stats->*m_field += m_timer.nsecsElapsed() * 1e-6;
+}
+
+void SolverStats::mergeInto(SolverStats* target, const SolverStats& local)
+{
+    if (!target) return;
+    QMutexLocker locker(&g_mergeMutex);
+    target->merge(local);
+}
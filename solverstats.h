@@ -0,0 +1,98 @@
+/*
+ * solverstats.h
+ * 文件作用: 求解器运行统计头文件
+ * 功能描述:
+ * 1. SolverStats 记录一次 (或多次累计) 理论曲线计算的计数器与各阶段耗时: 拉普拉斯核函数求值、
+ *    Bessel 函数求值、自适应积分细分次数与最大递归深度、影响矩阵方程组求解次数。
+ * 2. 运行期开关: 调用方在 SolverOptions::stats 中给出记录指针时才统计，未给出时热点路径只多一次线程局部指针判断
+ *    (活动记录指针与 active()、Scope 均在头文件中内联，不产生跨文件函数调用)。
+ * 3. 编译期开关: 未定义 WELLTEST_SOLVER_STATS 时 SOLVER_STATS_* 宏展开为空，热点路径不含任何统计代码
+ *    (SolverStats 类型仍然存在，记录保持为零)。
+ * 4. 多线程: 计数写入当前线程的活动记录 (SolverStats::Scope 设置)，热点路径不加锁；并行段中每个工作线程各用一份
+ *    局部记录，并行段结束后由调用线程合并，每次理论曲线计算只在结束时加锁合并一次到调用方记录。
+ */
+
+#ifndef SOLVERSTATS_H
+#define SOLVERSTATS_H
+
+#include <QString>
+#include <QtGlobal>
+#include <QElapsedTimer>
+
+struct SolverStats
+{
+    // 计数器
+    quint64 curves = 0;                 // 计算的理论曲线条数
+    quint64 laplaceEvaluations = 0;     // 拉普拉斯核函数求值次数 (不含插值与储层响应缓存命中)
+    quint64 complexEvaluations = 0;     // 其中复数核函数 (Talbot、de Hoog、Euler) 的求值次数
+    quint64 besselCalls = 0;            // Bessel 函数求值次数 (按自变量个数计)
+    quint64 quadratureSubdivisions = 0; // 自适应高斯积分的区间细分次数
+    int maxQuadratureDepth = 0;         // 自适应高斯积分达到的最大递归深度
+    quint64 linearSolves = 0;           // 裂缝影响矩阵方程组求解次数 (Toeplitz、H 矩阵与稠密求解合计，含失败后退回的求解)
+    quint64 asymptoticPoints = 0;       // 按渐近段闭式给出、未做数值反演的时间点数
+
+    // 各阶段耗时 (毫秒，调用线程的墙钟时间)
+    double typeCurveMs = 0.0;   // 典型曲线缓存查表与建表
+    double coarseGridMs = 0.0;  // 粗网格求解与插值
+    double prepareMs = 0.0;     // 反演准备 (阶数确定、拉普拉斯插值节点采样)
+    double inversionMs = 0.0;   // 逐点数值反演
+    double totalMs = 0.0;       // 整次调用
+
+    void reset() { *this = SolverStats(); }
+    // 累加另一份记录 (计数与耗时相加，最大深度取大者)
+    void merge(const SolverStats& other);
+    // 界面显示用的单行摘要
+    QString summary() const;
+
+    // 统计是否编译进求解器 (WELLTEST_SOLVER_STATS)
+    static bool compiledIn();
+
+    // 当前线程的活动记录，未统计时为空
+    static SolverStats* active() { return s_active; }
+
+    // 在作用域内把当前线程的活动记录设为 stats (可为空)，退出时恢复
+    class Scope
+    {
+    public:
+        explicit Scope(SolverStats* stats) : m_previous(s_active) { s_active = stats; }
+        ~Scope() { s_active = m_previous; }
+    private:
+        SolverStats* m_previous;
+        Q_DISABLE_COPY(Scope)
+    };
+
+    // 作用域计时: 活动记录存在时，退出作用域把经过时间累加到指定字段
+    class PhaseTimer
+    {
+    public:
+        explicit PhaseTimer(double SolverStats::*field);
+        ~PhaseTimer();
+    private:
+        SolverStats* m_stats;
+        double SolverStats::*m_field;
+        QElapsedTimer m_timer;
+        Q_DISABLE_COPY(PhaseTimer)
+    };
+
+    // 把 local 合并到 target (加锁，供多个线程向同一记录合并；每次理论曲线计算调用一次)
+    static void mergeInto(SolverStats* target, const SolverStats& local);
+
+private:
+    static inline thread_local SolverStats* s_active = nullptr;
+};
+
+#ifdef WELLTEST_SOLVER_STATS
+#define SOLVER_STATS_ADD(field, n) \
+    do { if (SolverStats* stats_ = SolverStats::active()) stats_->field += (n); } while (0)
+#define SOLVER_STATS_MAX(field, v) \
+    do { if (SolverStats* stats_ = SolverStats::active()) { if ((v) > stats_->field) stats_->field = (v); } } while (0)
+#define SOLVER_STATS_CONCAT_(a, b) a##b
+#define SOLVER_STATS_CONCAT(a, b) SOLVER_STATS_CONCAT_(a, b)
+#define SOLVER_STATS_PHASE(field) SolverStats::PhaseTimer SOLVER_STATS_CONCAT(statsPhase_, __LINE__)(&SolverStats::field)
+#else
+#define SOLVER_STATS_ADD(field, n) do {} while (0)
+#define SOLVER_STATS_MAX(field, v) do {} while (0)
+#define SOLVER_STATS_PHASE(field) do {} while (0)
+#endif
+
+#endif // SOLVERSTATS_H
@@ -0,0 +1,65 @@
+/*
+ * solverworkspace.cpp
+ * 文件作用: 求解器线程局部工作区实现
+ * 功能描述:
+ * 1. 线程局部实例的获取与等间距裂缝位置的生成。
+ * 2. 缓冲区扩容计数 (原子变量，供性能检查读取)。
+ */
+
+#include "solverworkspace.h"
+
+#include <atomic>
+
+namespace {
+std::atomic<quint64> g_allocations(0);
+}
+
+SolverWorkspace& SolverWorkspace::local()
+{
+    static thread_local SolverWorkspace workspace;
+    return workspace;
+}
+
+const QVector<double>& SolverWorkspace::fractureX(int nf)
+{
+    if (nf != m_nf) buildFractures(nf);
+    return m_xwD;
+}
+
+const QVector<double>& SolverWorkspace::fractureY(int nf)
+{
+    if (nf != m_nf) buildFractures(nf);
+    return m_ywD;
+}
+
+// 生成等间距裂缝位置: 单条裂缝位于原点，多条时在 [-0.9, 0.9] 上均匀分布，裂缝在 y 方向无偏移
+void SolverWorkspace::buildFractures(int nf)
+{
+    ensureSize(m_xwD, nf);
+    ensureSize(m_ywD, nf);
+    if (nf == 1) {
+        m_xwD[0] = 0.0;
+    } else {
+        double start = -0.9;
+        double end = 0.9;
+        double step = (end - start) / (nf - 1);
+        for (int i = 0; i < nf; ++i) m_xwD[i] = start + i * step;
+    }
+    m_ywD.fill(0.0);
+    m_nf = nf;
+}
+
+quint64 SolverWorkspace::allocationCount()
+{
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+void SolverWorkspace::resetAllocationCount()
+{
+    g_allocations.store(0, std::memory_order_relaxed);
+}
+
+void SolverWorkspace::countAllocation()
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+}
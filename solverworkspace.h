@@ -0,0 +1,98 @@
+/*
+ * solverworkspace.h
+ * 文件作用: 求解器线程局部工作区头文件
+ * 功能描述:
+ * 1. 保存拉普拉斯核函数热点路径中反复使用的缓冲区: 裂缝位置、影响系数、Toeplitz 递推向量、
+ *    稠密方程组的矩阵、右端项与 LU 分解。缓冲区按需扩容后复用，同一线程后续求值不再分配堆内存。
+ * 2. 每个线程一份 (SolverWorkspace::local())，由核函数入口取得后逐层传入。
+ * 3. 统计缓冲区扩容次数 (全部线程合计)，预热后计数不再增长即说明热点路径不再分配。
+ * 4. 例外: 裂缝段数超过 ModelSolver01_06::kHMatrixMinSegments 的非等间距布置走 H 矩阵路径，每次求值重新建立
+ *    聚类树、块划分、ACA 低秩因子、对角叶块 LU 与 GMRES 基 (块的秩随 z 变化，无法按固定大小复用)，不经过本工作区。
+ *    这部分分配次数与块数成正比，相对 nf² 个影响系数积分可以忽略；同一求值序列的分配次数不变。
+ */
+
+#ifndef SOLVERWORKSPACE_H
+#define SOLVERWORKSPACE_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <Eigen/Dense>
+#include <complex>
+
+// 某一标量类型 (double 或 std::complex<double>) 的缓冲区
+template <typename T>
+struct WorkspaceBuffers {
+    using Matrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+    using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+    // Toeplitz 快速求解: 第一列、右端项、解及递推中间向量
+    QVector<T> col, rhs, x, y, tmp;
+
+    // 一般稠密求解: 影响矩阵、右端项、解与 LU 分解 (大小不变时重复分解不再分配)
+    Matrix A;
+    Vector b, sol;
+    Eigen::PartialPivLU<Matrix> lu;
+};
+
+class SolverWorkspace
+{
+public:
+    // 当前线程的工作区
+    static SolverWorkspace& local();
+
+    // 等间距裂缝位置 xwD 与 ywD (按条数生成，条数不变时直接返回)
+    const QVector<double>& fractureX(int nf);
+    const QVector<double>& fractureY(int nf);
+
+    // 按标量类型取缓冲区
+    template <typename T>
+    WorkspaceBuffers<T>& buffers();
+
+    // 调整缓冲区大小，容量不足而重新分配时计数
+    template <typename V>
+    static void ensureSize(QVector<V>& v, int n);
+    template <typename M>
+    static void ensureSize(M& m, int rows, int cols);
+
+    // 缓冲区扩容次数 (全部线程合计)
+    static quint64 allocationCount();
+    static void resetAllocationCount();
+
+private:
+    SolverWorkspace() {}
+    static void countAllocation();
+    void buildFractures(int nf);
+
+    int m_nf = 0;
+    QVector<double> m_xwD;
+    QVector<double> m_ywD;
+    WorkspaceBuffers<double> m_real;
+    WorkspaceBuffers<std::complex<double>> m_complex;
+};
+
+template <>
+inline WorkspaceBuffers<double>& SolverWorkspace::buffers<double>() { return m_real; }
+
+template <>
+inline WorkspaceBuffers<std::complex<double>>& SolverWorkspace::buffers<std::complex<double>>() { return m_complex; }
+
+template <typename V>
+void SolverWorkspace::ensureSize(QVector<V>& v, int n)
+{
+    if (v.capacity() < n) {
+        countAllocation();
+        v.reserve(n);
+    }
+    v.resize(n);
+}
+
+template <typename M>
+void SolverWorkspace::ensureSize(M& m, int rows, int cols)
+{
+    if (m.rows() != rows || m.cols() != cols) {
+        countAllocation();
+        m.resize(rows, cols);
+    }
+}
+
+#endif // SOLVERWORKSPACE_H
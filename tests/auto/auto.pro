@@ -0,0 +1,11 @@
+# ----------------------------------------------------
+# 自动测试 (make check 运行)
+# ----------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+           besselbatch \
+           hmatrix \
+           inversionaccuracy \
+           solverworkspace
@@ -0,0 +1,11 @@
+# ----------------------------------------------------
+# 批量 Bessel 函数精度测试: 标量与 AVX2 路径对比 boost::math
+# ----------------------------------------------------
+
+TEMPLATE = app
+TARGET = tst_besselbatch
+CONFIG += testcase
+
+include(../../solvercore.pri)
+
+SOURCES += tst_besselbatch.cpp
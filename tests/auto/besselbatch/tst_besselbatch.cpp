@@ -0,0 +1,150 @@
+/*
+ * tst_besselbatch.cpp
+ * 文件作用: 批量 Bessel 函数精度测试
+ * 功能描述:
+ * 1. 在 [1e-10, 700] 全参数范围上 (对数均布，另在 K 函数分段点 2 与 I 函数分段点 8 两侧加密)，
+ *    把 BesselBatch 的 K0、K1、e^{-x}I0、e^{-x}I1 与 boost::math 比较，标量路径与 AVX2 路径分别检查最大相对误差。
+ * 2. 检查 AVX2 路径与标量路径逐点一致，数组长度不是 4 的倍数时尾部与单点接口一致，输出指针为空时不写入。
+ * 3. 全部通过返回 0，否则打印失败项并返回 1 (make check 运行)。
+ */
+
+#include "besselbatch.h"
+
+#include <boost/math/special_functions/bessel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+const double kTolerance = 1e-13;       // 与 boost 的最大相对误差
+const double kPathTolerance = 1e-14;   // AVX2 与标量路径的最大相对差 (FMA 舍入不同)
+const double kSplitPoints[] = { 2.0, 8.0 };
+
+int g_failures = 0;
+
+void check(bool ok, const char* what, double detail)
+{
+    std::printf("%s %-48s %.2e\n", ok ? "PASS" : "FAIL", what, detail);
+    if (!ok) ++g_failures;
+}
+
+double relativeError(double value, double reference)
+{
+    if (value == reference) return 0.0;
+    return std::abs(value - reference) / std::abs(reference);
+}
+
+std::vector<double> testArguments()
+{
+    std::vector<double> x;
+    const int n = 2001;
+    for (int i = 0; i < n; ++i) x.push_back(std::pow(10.0, -10.0 + (std::log10(700.0) + 10.0) * i / (n - 1)));
+    // 分段点两侧: 相对偏移 1e-15 ~ 1e-2
+    for (double split : kSplitPoints) {
+        x.push_back(split);
+        for (double e = 1e-15; e < 2e-2; e *= 10.0) {
+            x.push_back(split * (1.0 - e));
+            x.push_back(split * (1.0 + e));
+        }
+    }
+    x.push_back(700.0);
+    return x;
+}
+
+struct Values {
+    std::vector<double> k0, k1, i0e, i1e;
+    explicit Values(size_t n) : k0(n), k1(n), i0e(n), i1e(n) {}
+};
+
+Values evaluateBatch(const std::vector<double>& x)
+{
+    Values v(x.size());
+    BesselBatch::evaluate(x.data(), (int)x.size(), v.k0.data(), v.k1.data(), v.i0e.data(), v.i1e.data());
+    return v;
+}
+
+// 与 boost 比较，返回四个函数中的最大相对误差，并逐个报告
+double compareWithBoost(const char* path, const std::vector<double>& x, const Values& v)
+{
+    double worst[4] = { 0.0, 0.0, 0.0, 0.0 };
+    double worstX[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (size_t i = 0; i < x.size(); ++i) {
+        double xi = x[i];
+        double ref[4] = {
+            boost::math::cyl_bessel_k(0, xi),
+            boost::math::cyl_bessel_k(1, xi),
+            boost::math::cyl_bessel_i(0, xi) * std::exp(-xi),
+            boost::math::cyl_bessel_i(1, xi) * std::exp(-xi)
+        };
+        double got[4] = { v.k0[i], v.k1[i], v.i0e[i], v.i1e[i] };
+        for (int f = 0; f < 4; ++f) {
+            double e = relativeError(got[f], ref[f]);
+            if (!(e <= worst[f])) { worst[f] = e; worstX[f] = xi; }
+        }
+    }
+    static const char* names[4] = { "K0", "K1", "e^-x I0", "e^-x I1" };
+    double overall = 0.0;
+    for (int f = 0; f < 4; ++f) {
+        char what[96];
+        std::snprintf(what, sizeof(what), "%s %s vs boost (worst at x = %.6g)", path, names[f], worstX[f]);
+        check(worst[f] <= kTolerance, what, worst[f]);
+        overall = std::max(overall, worst[f]);
+    }
+    return overall;
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<double> x = testArguments();
+
+    BesselBatch::setForceScalar(true);
+    Values scalar = evaluateBatch(x);
+    compareWithBoost("scalar", x, scalar);
+
+    BesselBatch::setForceScalar(false);
+    if (BesselBatch::isVectorized()) {
+        Values vectorized = evaluateBatch(x);
+        compareWithBoost("avx2", x, vectorized);
+
+        double diff = 0.0;
+        for (size_t i = 0; i < x.size(); ++i) {
+            diff = std::max({ diff, relativeError(vectorized.k0[i], scalar.k0[i]), relativeError(vectorized.k1[i], scalar.k1[i]),
+                              relativeError(vectorized.i0e[i], scalar.i0e[i]), relativeError(vectorized.i1e[i], scalar.i1e[i]) });
+        }
+        check(diff <= kPathTolerance, "avx2 vs scalar", diff);
+    } else {
+        std::printf("SKIP avx2 path (not supported by this CPU or build)\n");
+    }
+
+    // 尾部元素 (长度 4k+1 ~ 4k+3) 与单点接口一致
+    double tailDiff = 0.0;
+    for (int n = 1; n <= 7; ++n) {
+        std::vector<double> xs(x.begin() + 100, x.begin() + 100 + n);
+        Values v = evaluateBatch(xs);
+        for (int i = 0; i < n; ++i) {
+            double k0, k1, i0e, i1e;
+            BesselBatch::evaluate(xs[i], k0, k1, i0e, i1e);
+            tailDiff = std::max({ tailDiff, relativeError(v.k0[i], k0), relativeError(v.k1[i], k1),
+                                  relativeError(v.i0e[i], i0e), relativeError(v.i1e[i], i1e) });
+        }
+    }
+    check(tailDiff <= kPathTolerance, "batch lengths 1..7 vs single-point", tailDiff);
+
+    // 只要求部分输出时其余输出不写入，已写入的值与完整求值相同
+    std::vector<double> k1Only(x.size(), -1.0);
+    std::vector<double> i0Only(x.size(), -1.0);
+    BesselBatch::evaluate(x.data(), (int)x.size(), nullptr, k1Only.data(), nullptr, nullptr);
+    BesselBatch::evaluate(x.data(), (int)x.size(), nullptr, nullptr, i0Only.data(), nullptr);
+    double partialDiff = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        partialDiff = std::max({ partialDiff, relativeError(k1Only[i], scalar.k1[i]), relativeError(i0Only[i], scalar.i0e[i]) });
+    }
+    check(partialDiff <= kPathTolerance, "partial outputs vs full evaluation", partialDiff);
+
+    std::printf("%d argument(s), %d failure(s)\n", (int)x.size(), g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+# ----------------------------------------------------
+# H 矩阵测试: GMRES 解与矩阵元素求值量对比稠密 LU
+# ----------------------------------------------------
+
+TEMPLATE = app
+TARGET = tst_hmatrix
+CONFIG += testcase
+
+include(../../solvercore.pri)
+
+SOURCES += tst_hmatrix.cpp
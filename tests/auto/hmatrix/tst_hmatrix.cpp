@@ -0,0 +1,128 @@
+/*
+ * tst_hmatrix.cpp
+ * 文件作用: H 矩阵求解精度与求值量测试
+ * 功能描述:
+ * 1. 三分支多段裂缝布置 (各分支等距、段间不重叠)，矩阵元素为沿裂缝段平均的 K0(√g·r) 影响系数
+ *    (8 点 Gauss-Legendre，与求解器的影响矩阵形态相同)，g 取 0.001、0.05、1。
+ * 2. 与逐元素求值后 fullPivLu 求解的稠密参考解比较: GMRES 解的相对误差、展开矩阵与精确矩阵的相对差。
+ * 3. 求值量: 回调实际调用次数与 evaluatedEntries() 一致，且任何布置都不超过稠密填充的 n² 个元素
+ *    (ACA 未收敛的远场块沿用已求值的行与列)；段数较多时不超过 n² 的 kMaxLargeFraction。
+ * 4. 复数标量另测一次 (元素乘以固定复相位，解相应除以该相位)。
+ * 5. 全部通过返回 0，否则打印失败项并返回 1 (make check 运行)。
+ */
+
+#include "hmatrix.h"
+
+#include <boost/math/special_functions/bessel.hpp>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+
+namespace {
+
+const double kAcaTolerance = 1e-10;        // 与求解器 kHMatrixAcaTolerance、kHMatrixSolveTolerance 一致
+const double kSolveTolerance = 1e-12;
+const double kSolutionTolerance = 1e-7;    // GMRES 解与稠密 LU 解的相对差
+const double kMatrixTolerance = 1e-8;      // 展开矩阵与精确矩阵的相对差 (Frobenius 范数)
+const double kMaxLargeFraction = 0.6;      // 段数较多时求值量占 n² 的上限
+const double kCouplings[] = { 0.001, 0.05, 1.0 };
+
+const double kGaussNodes[8] = { -0.9602898564975363, -0.7966664774136267, -0.5255324099163290, -0.1834346424956498,
+                                0.1834346424956498, 0.5255324099163290, 0.7966664774136267, 0.9602898564975363 };
+const double kGaussWeights[8] = { 0.1012285362903763, 0.2223810344533745, 0.3137066458778873, 0.3626837833783620,
+                                  0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763 };
+
+int g_failures = 0;
+
+void check(bool ok, const char* what, double detail)
+{
+    std::printf("%s %-60s %.2e\n", ok ? "PASS" : "FAIL", what, detail);
+    if (!ok) ++g_failures;
+}
+
+// 三条分支 (yD = -0.5, 0, 0.5)，每条 perLateral 段均布于 [-0.9, 0.9]，半长取段距的 0.4 倍 (互不重叠)
+struct Layout {
+    QVector<double> x, y, radius;
+    explicit Layout(int perLateral) {
+        double step = 1.8 / (perLateral - 1);
+        for (int l = 0; l < 3; ++l) {
+            for (int i = 0; i < perLateral; ++i) {
+                x.append(-0.9 + i * step);
+                y.append(-0.5 + 0.5 * l);
+                radius.append(0.4 * step);
+            }
+        }
+    }
+    int size() const { return x.size(); }
+};
+
+// 第 j 段 (均匀流量) 在第 i 段中心处的平均影响
+double influence(const Layout& layout, double sqrtG, int i, int j)
+{
+    double sum = 0.0;
+    for (int q = 0; q < 8; ++q) {
+        double dx = layout.x[i] - layout.x[j] - layout.radius[j] * kGaussNodes[q];
+        double dy = layout.y[i] - layout.y[j];
+        sum += kGaussWeights[q] * boost::math::cyl_bessel_k(0, sqrtG * std::sqrt(dx * dx + dy * dy));
+    }
+    return 0.5 * sum;
+}
+
+template <typename T>
+void testLayout(const Layout& layout, double g, T phase, double maxFraction, const char* scalarName)
+{
+    using H = HMatrix<T>;
+    int n = layout.size();
+    double sqrtG = std::sqrt(g);
+    qint64 calls = 0;
+    typename H::EntryFunction entry = [&](int i, int j) {
+        ++calls;
+        return phase * influence(layout, sqrtG, i, j);
+    };
+
+    H hmat;
+    typename H::Options options;
+    options.acaTolerance = kAcaTolerance;
+    hmat.build(layout.x, layout.y, layout.radius, entry, options);
+    typename H::Vector b = H::Vector::Ones(n);
+    typename H::Vector x = H::Vector::Zero(n);
+    bool converged = hmat.solve(b, x, kSolveTolerance);
+
+    typename H::Matrix dense(n, n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) dense(i, j) = phase * influence(layout, sqrtG, i, j);
+    }
+    typename H::Vector reference = dense.fullPivLu().solve(b);
+
+    char what[128];
+    std::snprintf(what, sizeof(what), "%s n=%d g=%g GMRES converged", scalarName, n, g);
+    check(converged, what, 0.0);
+    double solutionError = (x - reference).norm() / reference.norm();
+    std::snprintf(what, sizeof(what), "%s n=%d g=%g solution vs dense LU", scalarName, n, g);
+    check(solutionError <= kSolutionTolerance, what, solutionError);
+    double matrixError = (hmat.toDense() - dense).norm() / dense.norm();
+    std::snprintf(what, sizeof(what), "%s n=%d g=%g expanded matrix vs dense", scalarName, n, g);
+    check(matrixError <= kMatrixTolerance, what, matrixError);
+
+    std::snprintf(what, sizeof(what), "%s n=%d g=%g evaluated entries match callback calls", scalarName, n, g);
+    check(hmat.evaluatedEntries() == calls, what, (double)(hmat.evaluatedEntries() - calls));
+    double fraction = (double)hmat.evaluatedEntries() / ((double)n * n);
+    std::snprintf(what, sizeof(what), "%s n=%d g=%g evaluated / n^2 (%d low-rank, %d dense)",
+                  scalarName, n, g, hmat.lowRankBlocks(), hmat.denseBlocks());
+    check(fraction <= maxFraction, what, fraction);
+}
+
+} // namespace
+
+int main()
+{
+    Layout medium(100);
+    for (double g : kCouplings) testLayout<double>(medium, g, 1.0, 1.0, "real");
+    testLayout<std::complex<double>>(medium, 0.05, std::complex<double>(0.6, 0.8), 1.0, "complex");
+
+    Layout large(400);
+    testLayout<double>(large, 0.05, 1.0, kMaxLargeFraction, "real");
+
+    std::printf("%d failure(s)\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
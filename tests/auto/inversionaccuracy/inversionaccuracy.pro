@@ -0,0 +1,11 @@
+# ----------------------------------------------------
+# 数值反演精度测试: 自适应阶数 Stehfest 对比高阶 Talbot 参考解
+# ----------------------------------------------------
+
+TEMPLATE = app
+TARGET = tst_inversionaccuracy
+CONFIG += testcase
+
+include(../../solvercore.pri)
+
+SOURCES += tst_inversionaccuracy.cpp
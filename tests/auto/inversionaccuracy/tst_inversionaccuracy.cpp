@@ -0,0 +1,98 @@
+/*
+ * tst_inversionaccuracy.cpp
+ * 文件作用: 数值反演精度测试
+ * 功能描述:
+ * 1. 参考解为 32 节点 Talbot 围道 (积分容差 1e-8、深度 14，与 AccuracyTuner 的参考解相同)，
+ *    六类模型的缺省参数，400 个对数均布时间点 (1e-4 ~ 1e4)，误差按 AccuracyTuner::relativeError 计。
+ * 2. 自适应阶数 Stehfest (报告档位的阶数范围 8~16，关闭拉普拉斯插值) 不得比固定取上限阶数差，
+ *    且不超过各模型的误差上限 (变井储模型的井储驼峰段 Stehfest 本身只能达到约 5e-3)。
+ * 3. 阶数上限放宽到 30 时，舍入误差放大的高阶不得被选中: 误差不超过固定 16 阶的 2 倍。
+ * 4. 拉普拉斯插值模式与直接求值的相对差 (固定阶数 4~16 与报告档位的自适应阶数) 不超过 kInterpolationBound，
+ *    插值误差经 Stehfest 系数放大后仍须明显小于报告档位的目标误差。
+ * 5. 全部通过返回 0，否则打印失败项并返回 1 (make check 运行)。
+ */
+
+#include "accuracyprofile.h"
+#include "testmodels.h"
+
+#include <cstdio>
+
+namespace {
+
+const int kPoints = 400;
+const double kStorageModelBound = 1e-2;   // 变井储模型 (1、3、5) 的误差上限
+const double kNoStorageModelBound = 2e-4; // 恒定井储模型 (2、4、6) 的误差上限
+const double kInterpolationBound = 1e-5;  // 插值模式与直接求值的最大相对差
+
+int g_failures = 0;
+
+void check(bool ok, const char* what, double detail)
+{
+    std::printf("%s %-52s %.2e\n", ok ? "PASS" : "FAIL", what, detail);
+    if (!ok) ++g_failures;
+}
+
+SolverOptions referenceOptions()
+{
+    SolverOptions o;
+    o.inversion = InversionMethod::Talbot;
+    o.inversionOrder = 32;
+    o.laplaceInterpolation = false;
+    o.quadratureTolerance = 1e-8;
+    o.quadratureMaxDepth = 14;
+    return o;
+}
+
+SolverOptions stehfestOptions(int N, int maxN, bool interpolation = false)
+{
+    SolverOptions o = AccuracyProfiles::options(AccuracyProfile::Report);
+    o.inversion = InversionMethod::Stehfest;
+    o.stehfestN = N;
+    o.stehfestMaxN = maxN;
+    o.laplaceInterpolation = interpolation;
+    return o;
+}
+
+} // namespace
+
+int main()
+{
+    QVector<double> t = ModelSolver01_06::generateLogTimeSteps(kPoints, -4.0, 4.0);
+    char what[128];
+
+    for (int m = 0; m < TestModels::kModelCount; ++m) {
+        ModelSolver01_06::ModelType type = (ModelSolver01_06::ModelType)m;
+        ModelSolver01_06 solver(type);
+        ModelParams params = TestModels::defaultParams(type);
+        ModelCurveData reference = solver.calculateTheoreticalCurve(params, t, referenceOptions());
+        auto errorOf = [&](const SolverOptions& options) {
+            return AccuracyTuner::relativeError(solver.calculateTheoreticalCurve(params, t, options), reference);
+        };
+
+        double adaptive = errorOf(stehfestOptions(8, 16));
+        double fixed16 = errorOf(stehfestOptions(16, 0));
+        double adaptiveWide = errorOf(stehfestOptions(8, 30));
+        bool storage = (type == ModelSolver01_06::Model_1 || type == ModelSolver01_06::Model_3 || type == ModelSolver01_06::Model_5);
+
+        std::snprintf(what, sizeof(what), "Model_%d adaptive 8~16 vs fixed 16 (%.2e)", m + 1, fixed16);
+        check(adaptive <= 1.05 * fixed16, what, adaptive);
+        std::snprintf(what, sizeof(what), "Model_%d adaptive 8~16 vs Talbot", m + 1);
+        check(adaptive <= (storage ? kStorageModelBound : kNoStorageModelBound), what, adaptive);
+        std::snprintf(what, sizeof(what), "Model_%d adaptive 8~30 vs fixed 16 (%.2e)", m + 1, fixed16);
+        check(adaptiveWide <= 2.0 * fixed16, what, adaptiveWide);
+
+        // 插值模式对比直接求值 (400 点时插值条件满足，是否实际插值由求解器按容差决定)
+        const int orders[][2] = { { 4, 0 }, { 8, 0 }, { 12, 0 }, { 16, 0 }, { 8, 16 } };
+        for (const auto& order : orders) {
+            ModelCurveData direct = solver.calculateTheoreticalCurve(params, t, stehfestOptions(order[0], order[1], false));
+            ModelCurveData interpolated = solver.calculateTheoreticalCurve(params, t, stehfestOptions(order[0], order[1], true));
+            double diff = AccuracyTuner::relativeError(interpolated, direct);
+            if (order[1] > 0) std::snprintf(what, sizeof(what), "Model_%d interpolated vs direct N=%d~%d", m + 1, order[0], order[1]);
+            else std::snprintf(what, sizeof(what), "Model_%d interpolated vs direct N=%d", m + 1, order[0]);
+            check(diff <= kInterpolationBound, what, diff);
+        }
+    }
+
+    std::printf("%d failure(s)\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+# ----------------------------------------------------
+# 求解器堆分配测试: 预热后拉普拉斯求值不再分配堆内存
+# ----------------------------------------------------
+
+TEMPLATE = app
+TARGET = tst_solverworkspace
+CONFIG += testcase
+
+include(../../solvercore.pri)
+
+SOURCES += tst_solverworkspace.cpp
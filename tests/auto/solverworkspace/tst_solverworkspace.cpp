@@ -0,0 +1,276 @@
+/*
+ * tst_solverworkspace.cpp
+ * 文件作用: 求解器堆分配测试
+ * 功能描述:
+ * 1. 替换全局分配函数统计堆分配次数: glibc 下直接替换 malloc/calloc/realloc (Qt 容器与 Eigen 均经 malloc 分配，
+ *    operator new 也落到 malloc)；MSVC 调试运行库下用 _CrtSetAllocHook；其他平台只替换 operator new。
+ * 2. 六类模型的特化核函数 (实数与复数，等间距布置与非等间距双分支布置) 预热后重复求值，堆分配次数必须为 0，
+ *    SolverWorkspace 的扩容计数也不再增长。
+ *    裂缝段数超过 kHMatrixMinSegments 的双分支布置走 H 矩阵路径，按 solverworkspace.h 的约定每次求值都要分配:
+ *    检查分配次数大于 0 (确实走到 H 矩阵路径)、工作区不再扩容、预热后两次相同的求值序列分配次数相等
+ *    (与求值次数成正比，不随调用累积)，并打印每次求值的分配次数。该布置求值很慢，不做理论曲线测试。
+ * 3. 六类模型在 Stehfest (直接求值与拉普拉斯插值) 与 Talbot 下重复调用 calculateTheoreticalCurve:
+ *    一次调用本身要分配结果向量、时间序列与插值节点等固定数量的缓冲区，因此检查的是预热后
+ *    "每次调用的分配次数与时间点数无关" —— 时间点数加倍 (拉普拉斯求值次数随之加倍) 时分配次数不变，
+ *    即每次拉普拉斯求值与逐点反演的分配为 0；同样点数重复调用的分配次数也必须不变。
+ *    Stehfest 与 Talbot 另各测一次开启储层响应缓存 (reservoirCache) 的情形: 预热后储层响应全部命中缓存快照，
+ *    查表路径 (快照查找与本线程新增值表的登记) 的分配同样与时间点数无关。
+ * 4. 求解器线程数设为 1，所有求值在调用线程串行执行 (线程池调度本身会分配，且各次调用不确定)。
+ * 5. 全部通过返回 0，否则打印失败项并返回 1 (make check 运行)。
+ */
+
+#include "solverworkspace.h"
+#include "testmodels.h"
+
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+// ---- 分配计数 ----
+
+namespace {
+
+std::atomic<bool> g_counting(false);
+std::atomic<long> g_allocations(0);
+
+inline void countAllocation()
+{
+    if (g_counting.load(std::memory_order_relaxed)) g_allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+#if defined(__GLIBC__)
+
+extern "C" {
+void* __libc_malloc(size_t n);
+void* __libc_calloc(size_t count, size_t n);
+void* __libc_realloc(void* p, size_t n);
+void* __libc_memalign(size_t alignment, size_t n);
+void __libc_free(void* p);
+
+void* malloc(size_t n) { countAllocation(); return __libc_malloc(n); }
+void* calloc(size_t count, size_t n) { countAllocation(); return __libc_calloc(count, n); }
+void* realloc(void* p, size_t n) { countAllocation(); return __libc_realloc(p, n); }
+void* memalign(size_t alignment, size_t n) { countAllocation(); return __libc_memalign(alignment, n); }
+void* aligned_alloc(size_t alignment, size_t n) { countAllocation(); return __libc_memalign(alignment, n); }
+int posix_memalign(void** out, size_t alignment, size_t n)
+{
+    countAllocation();
+    void* p = __libc_memalign(alignment, n);
+    if (!p) return 12; // ENOMEM
+    *out = p;
+    return 0;
+}
+void free(void* p) { __libc_free(p); }
+}
+
+static const char* kCounterName = "malloc";
+
+#elif defined(_MSC_VER) && defined(_DEBUG)
+
+#include <crtdbg.h>
+
+static int allocationHook(int type, void*, size_t, int, long, const unsigned char*, int)
+{
+    if (type == _HOOK_ALLOC || type == _HOOK_REALLOC) countAllocation();
+    return 1;
+}
+
+static const char* kCounterName = "CRT debug heap";
+
+#else
+
+void* operator new(size_t n)
+{
+    countAllocation();
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t n) { return operator new(n); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+
+static const char* kCounterName = "operator new (malloc not counted)";
+
+#endif
+
+namespace {
+
+const int kKernelEvaluations = 200;
+const int kHMatrixKernelEvaluations = 8;
+const int kCurvePoints = 150;   // 与 300 点比较；两者均超过 Stehfest 拉普拉斯插值的启用门槛 (N = 4)
+const int kWarmUpCalls = 2;
+
+int g_failures = 0;
+
+void check(bool ok, const char* what, long detail)
+{
+    std::printf("%s %-64s %ld\n", ok ? "PASS" : "FAIL", what, detail);
+    if (!ok) ++g_failures;
+}
+
+long allocationsDuring(const std::function<void()>& f)
+{
+    g_allocations.store(0);
+    g_counting.store(true);
+    f();
+    g_counting.store(false);
+    return g_allocations.load();
+}
+
+// 非等间距、半长不同的双分支布置 (影响矩阵不是 Toeplitz 矩阵，走稠密 LU 路径)
+ModelParams withIrregularGeometry(ModelParams params)
+{
+    QSharedPointer<FractureGeometry> geometry(new FractureGeometry);
+    geometry->append(-0.8, 0.0, 0.08);
+    geometry->append(-0.3, 0.0, 0.12);
+    geometry->append(0.5, 0.0, 0.1);
+    geometry->append(-0.5, 0.4, 0.1);
+    geometry->append(0.4, 0.4, 0.06);
+    params.geometry = geometry;
+    return params;
+}
+
+// 72 段 (超过 H 矩阵门槛 kHMatrixMinSegments = 64) 的双分支布置: 每支等间距、半长交替不同 (不是 Toeplitz 矩阵)，
+// 相邻段不交叠
+ModelParams withLargeGeometry(ModelParams params)
+{
+    const int perBranch = 36;
+    const double spacing = 1.8 / (perBranch - 1);
+    QSharedPointer<FractureGeometry> geometry(new FractureGeometry);
+    for (int branch = 0; branch < 2; ++branch) {
+        for (int i = 0; i < perBranch; ++i) {
+            geometry->append(-0.9 + spacing * i, 0.4 * branch, (i % 2 ? 0.25 : 0.4) * spacing);
+        }
+    }
+    params.geometry = geometry;
+    return params;
+}
+
+enum class LayoutKind { Uniform, Irregular, HMatrix };
+
+struct Layout {
+    const char* name;
+    LayoutKind kind;
+};
+
+const Layout kLayouts[] = {
+    { "uniform", LayoutKind::Uniform },
+    { "irregular", LayoutKind::Irregular },
+    { "hmatrix", LayoutKind::HMatrix },
+};
+
+ModelParams paramsFor(ModelSolver01_06::ModelType type, const Layout& layout)
+{
+    ModelParams params = TestModels::defaultParams(type);
+    if (layout.kind == LayoutKind::Irregular) return withIrregularGeometry(params);
+    if (layout.kind == LayoutKind::HMatrix) return withLargeGeometry(params);
+    return params;
+}
+
+struct CurveConfiguration {
+    const char* name;
+    InversionMethod method;
+    bool laplaceInterpolation;
+    bool reservoirCache;
+};
+
+const CurveConfiguration kCurveConfigurations[] = {
+    { "Stehfest", InversionMethod::Stehfest, false, false },
+    { "Stehfest+interp", InversionMethod::Stehfest, true, false },
+    { "Talbot", InversionMethod::Talbot, false, false },
+    { "Stehfest+memo", InversionMethod::Stehfest, false, true },
+    { "Talbot+memo", InversionMethod::Talbot, false, true },
+};
+
+void testKernels(ModelSolver01_06::ModelType type, const Layout& layout)
+{
+    ModelParams params = paramsFor(type, layout);
+    ModelSolver01_06::LaplaceKernel kernel = ModelSolver01_06::kernelFor(type);
+    ModelSolver01_06::ComplexLaplaceKernel complexKernel = ModelSolver01_06::complexKernelFor(type);
+
+    const bool hmatrix = layout.kind == LayoutKind::HMatrix;
+    const int evaluations = hmatrix ? kHMatrixKernelEvaluations : kKernelEvaluations;
+    double sink = 0.0;
+    auto sweep = [&] {
+        for (int i = 0; i < evaluations; ++i) {
+            double z = std::pow(10.0, -4.0 + 8.0 * i / (evaluations - 1));
+            sink += kernel(z, params);
+            sink += std::real(complexKernel(std::complex<double>(z, 0.5 * z), params));
+        }
+    };
+    sweep(); // 预热: 工作区扩容与各函数的静态表初始化
+    quint64 grown = SolverWorkspace::allocationCount();
+    long allocations = allocationsDuring(sweep);
+    char what[96];
+    if (hmatrix) {
+        // H 矩阵每次求值的分配不经过工作区 (见 solverworkspace.h)，同一求值序列的分配次数必须不变；
+        // 分配为 0 说明布置没有走到 H 矩阵路径，测试失去意义
+        long repeated = allocationsDuring(sweep);
+        std::snprintf(what, sizeof(what), "Model_%d %-9s kernel evaluations repeat (%ld per evaluation)",
+                      (int)type + 1, layout.name, allocations / (2 * evaluations));
+        check(allocations > 0 && repeated == allocations && SolverWorkspace::allocationCount() == grown
+              && std::isfinite(sink), what, repeated - allocations);
+        return;
+    }
+    std::snprintf(what, sizeof(what), "Model_%d %-9s kernel evaluations after warm-up", (int)type + 1, layout.name);
+    check(allocations == 0 && SolverWorkspace::allocationCount() == grown && std::isfinite(sink), what, allocations);
+}
+
+void testCurves(ModelSolver01_06::ModelType type, const Layout& layout, const CurveConfiguration& c)
+{
+    ModelSolver01_06 solver(type);
+    ModelParams params = paramsFor(type, layout);
+    SolverOptions options;
+    options.inversion = c.method;
+    options.laplaceInterpolation = c.laplaceInterpolation;
+    options.reservoirCache = c.reservoirCache;
+    QVector<double> t = ModelSolver01_06::generateLogTimeSteps(kCurvePoints, -3.0, 3.0);
+    QVector<double> t2 = ModelSolver01_06::generateLogTimeSteps(2 * kCurvePoints, -3.0, 3.0);
+
+    for (int i = 0; i < kWarmUpCalls; ++i) {
+        solver.calculateTheoreticalCurve(params, t, options);
+        solver.calculateTheoreticalCurve(params, t2, options);
+    }
+    long first = allocationsDuring([&] { solver.calculateTheoreticalCurve(params, t, options); });
+    long doubled = allocationsDuring([&] { solver.calculateTheoreticalCurve(params, t2, options); });
+    long repeated = allocationsDuring([&] { solver.calculateTheoreticalCurve(params, t, options); });
+
+    char what[96];
+    std::snprintf(what, sizeof(what), "Model_%d %-9s %-15s per-point allocations (%d vs %d pts)",
+                  (int)type + 1, layout.name, c.name, kCurvePoints, 2 * kCurvePoints);
+    check(doubled == first, what, doubled - first);
+    std::snprintf(what, sizeof(what), "Model_%d %-9s %-15s repeated call (%ld per call)",
+                  (int)type + 1, layout.name, c.name, first);
+    check(repeated == first, what, repeated - first);
+}
+
+} // namespace
+
+int main()
+{
+#if defined(_MSC_VER) && defined(_DEBUG) && !defined(__GLIBC__)
+    _CrtSetAllocHook(allocationHook);
+#endif
+    std::printf("counting %s\n", kCounterName);
+    ModelSolver01_06::setMaxThreadCount(1);
+
+    for (int m = 0; m < TestModels::kModelCount; ++m) {
+        ModelSolver01_06::ModelType type = (ModelSolver01_06::ModelType)m;
+        for (const Layout& layout : kLayouts) {
+            testKernels(type, layout);
+            if (layout.kind == LayoutKind::HMatrix) continue;
+            for (const CurveConfiguration& c : kCurveConfigurations) testCurves(type, layout, c);
+        }
+    }
+
+    std::printf("%d failure(s)\n", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
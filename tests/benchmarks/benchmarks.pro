@@ -0,0 +1,10 @@
+# ----------------------------------------------------
+# 基准程序
+# ----------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+           fitting \
+           inversion \
+           linesource
@@ -0,0 +1,14 @@
+# ----------------------------------------------------
+# 拟合策略基准: 回放项目文件中的拟合数据集，比较各迭代策略、雅可比更新方式与步长解法
+# ----------------------------------------------------
+
+TEMPLATE = app
+TARGET = bench_fitting
+
+include(../../solvercore.pri)
+
+HEADERS += $$ROOT/fitbenchmark.h
+
+SOURCES += \
+           $$ROOT/fitbenchmark.cpp \
+           bench_fitting.cpp
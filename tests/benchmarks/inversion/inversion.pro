@@ -0,0 +1,13 @@
+# ----------------------------------------------------
+# 数值反演基准: Stehfest、Talbot、de Hoog、Euler 在六类模型上的求值次数、耗时与误差
+# ----------------------------------------------------
+
+TEMPLATE = app
+TARGET = bench_inversion
+
+include(../../solvercore.pri)
+
+# 拉普拉斯求值次数由求解统计给出
+DEFINES += WELLTEST_SOLVER_STATS
+
+SOURCES += bench_inversion.cpp
@@ -0,0 +1,188 @@
+/*
+ * bench_linesource.cpp
+ * 文件作用: 线源积分基准程序
+ * 功能描述:
+ * 1. 以缺省参数的等间距裂缝布置 (nf = 4, LfD = 0.1) 组装共线裂缝影响系数矩阵，
+ *    对比闭式线源积分 (LineSourceIntegral) 与改造前的自适应 15 点 Gauss 积分 (容差 1e-5、最大深度 10) 的耗时。
+ * 2. 以高精度 tanh-sinh 积分为参考，给出两种方法矩阵元素的最大相对误差。
+ * 3. 给出当前求解器计算一条 40 点理论曲线的耗时。
+ * 用法: bench_linesource [重复时间(ms)，缺省 500]
+ */
+
+#include "linesourceintegral.h"
+#include "testmodels.h"
+
+#include <QElapsedTimer>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/quadrature/tanh_sinh.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+const int kFractures = 4;
+const double kLfD = 0.1;
+const double kRmD = 4.0;
+const double kAcPrefactor = 0.5; // 复合界面系数取固定值，只影响 I0 项的量级
+const int kGammaCount = 60;      // γ 在 [1e-3, 1e2] 上对数均布
+
+// ---- 改造前的求解路径 (与原 ModelSolver01_06::gauss15/adaptiveGauss/scaled_besseli 相同) ----
+
+double scaledBesselI(int v, double x)
+{
+    if (x < 0) x = -x;
+    if (x > 600.0) return 1.0 / std::sqrt(2.0 * M_PI * x);
+    return boost::math::cyl_bessel_i(v, x) * std::exp(-x);
+}
+
+double gauss15(const std::function<double(double)>& f, double a, double b)
+{
+    static const double X[] = { 0.0, 0.201194, 0.394151, 0.570972, 0.724418, 0.848207, 0.937299, 0.987993 };
+    static const double W[] = { 0.202578, 0.198431, 0.186161, 0.166269, 0.139571, 0.107159, 0.070366, 0.030753 };
+    double h = 0.5 * (b - a); double c = 0.5 * (a + b); double s = W[0] * f(c);
+    for (int i = 1; i < 8; ++i) { double dx = h * X[i]; s += W[i] * (f(c - dx) + f(c + dx)); }
+    return s * h;
+}
+
+double adaptiveGauss(const std::function<double(double)>& f, double a, double b, double eps, int depth, int maxDepth)
+{
+    double c = (a + b) / 2.0; double v1 = gauss15(f, a, b); double v2 = gauss15(f, a, c) + gauss15(f, c, b);
+    if (depth >= maxDepth || std::abs(v1 - v2) < 1e-10 * std::abs(v2) + eps) return v2;
+    return adaptiveGauss(f, a, c, eps / 2, depth + 1, maxDepth) + adaptiveGauss(f, c, b, eps / 2, depth + 1, maxDepth);
+}
+
+double quadratureEntry(double gamma, double dx)
+{
+    double arg_g1_rm = gamma * kRmD;
+    auto integrand = [&](double a) -> double {
+        double arg_dist = gamma * std::abs(dx - a);
+        if (arg_dist < 1e-10) arg_dist = 1e-10;
+        double term2 = 0.0;
+        double exponent = arg_dist - arg_g1_rm;
+        if (exponent > -700.0) term2 = kAcPrefactor * scaledBesselI(0, arg_dist) * std::exp(exponent);
+        return boost::math::cyl_bessel_k(0, arg_dist) + term2;
+    };
+    return adaptiveGauss(integrand, -kLfD, kLfD, 1e-5, 0, 10);
+}
+
+// ---- 闭式线源积分 (与 PWD_composite 的共线分支相同) ----
+
+double closedFormEntry(double gamma, double dx)
+{
+    double arg_g1_rm = gamma * kRmD;
+    double val = LineSourceIntegral::segmentK0(gamma, dx - kLfD, dx + kLfD);
+    if (gamma * (std::abs(dx) + kLfD) - arg_g1_rm > -700.0) {
+        val += kAcPrefactor * LineSourceIntegral::segmentI0Scaled(gamma, dx - kLfD, dx + kLfD, arg_g1_rm);
+    }
+    return val;
+}
+
+// ---- 参考值: tanh-sinh 积分，在 K0 的对数奇点处分段 ----
+
+double referenceEntry(double gamma, double dx)
+{
+    double arg_g1_rm = gamma * kRmD;
+    auto f = [&](double u) -> double {
+        double x = gamma * std::abs(u);
+        double val = boost::math::cyl_bessel_k(0, x);
+        if (x - arg_g1_rm > -700.0) val += kAcPrefactor * scaledBesselI(0, x) * std::exp(x - arg_g1_rm);
+        return val;
+    };
+    boost::math::quadrature::tanh_sinh<double> integrator;
+    double u1 = dx - kLfD, u2 = dx + kLfD;
+    if (u1 < 0.0 && u2 > 0.0) return integrator.integrate(f, u1, 0.0, 1e-13) + integrator.integrate(f, 0.0, u2, 1e-13);
+    return integrator.integrate(f, u1, u2, 1e-13);
+}
+
+// 组装全部 γ 下的影响系数矩阵 (只保留 i 与 j 中心之差 dx 的函数值)
+double fillAll(double (*entry)(double, double), const std::vector<double>& gammas, const std::vector<double>& xwD, std::vector<double>* out)
+{
+    double checksum = 0.0;
+    int k = 0;
+    for (double gamma : gammas) {
+        for (int i = 0; i < kFractures; ++i) {
+            for (int j = 0; j < kFractures; ++j) {
+                double v = entry(gamma, xwD[i] - xwD[j]);
+                checksum += v;
+                if (out) (*out)[k++] = v;
+            }
+        }
+    }
+    return checksum;
+}
+
+// 重复组装直到耗时不少于 minMs，返回每次组装 (全部 γ) 的平均毫秒数
+double timeFill(double (*entry)(double, double), const std::vector<double>& gammas, const std::vector<double>& xwD, double minMs, double& checksum)
+{
+    QElapsedTimer timer;
+    timer.start();
+    int repeats = 0;
+    do {
+        checksum += fillAll(entry, gammas, xwD, nullptr);
+        ++repeats;
+    } while (timer.nsecsElapsed() * 1e-6 < minMs);
+    return timer.nsecsElapsed() * 1e-6 / repeats;
+}
+
+double maxRelativeError(const std::vector<double>& values, const std::vector<double>& reference)
+{
+    double worst = 0.0;
+    for (size_t k = 0; k < values.size(); ++k) {
+        worst = std::max(worst, std::abs(values[k] - reference[k]) / std::abs(reference[k]));
+    }
+    return worst;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    double minMs = argc > 1 ? std::atof(argv[1]) : 500.0;
+
+    std::vector<double> gammas(kGammaCount);
+    for (int k = 0; k < kGammaCount; ++k) gammas[k] = std::pow(10.0, -3.0 + 5.0 * k / (kGammaCount - 1));
+    std::vector<double> xwD(kFractures);
+    for (int i = 0; i < kFractures; ++i) xwD[i] = -0.9 + 1.8 * i / (kFractures - 1);
+
+    const size_t entries = gammas.size() * kFractures * kFractures;
+    std::vector<double> reference(entries), quadrature(entries), closedForm(entries);
+    fillAll(referenceEntry, gammas, xwD, &reference);
+    fillAll(quadratureEntry, gammas, xwD, &quadrature);
+    fillAll(closedFormEntry, gammas, xwD, &closedForm);
+
+    double checksum = 0.0;
+    double quadratureMs = timeFill(quadratureEntry, gammas, xwD, minMs, checksum);
+    double closedFormMs = timeFill(closedFormEntry, gammas, xwD, minMs, checksum);
+
+    std::printf("影响系数矩阵: nf = %d, LfD = %g, %d 个 γ ∈ [1e-3, 1e2], 共 %d 个积分\n",
+                kFractures, kLfD, kGammaCount, (int)entries);
+    std::printf("%-24s %14s %14s\n", "方法", "耗时/积分(us)", "最大相对误差");
+    std::printf("%-24s %14.3f %14.2e\n", "自适应 Gauss (1e-5, 10)", quadratureMs * 1e3 / entries, maxRelativeError(quadrature, reference));
+    std::printf("%-24s %14.3f %14.2e\n", "闭式 Ki1", closedFormMs * 1e3 / entries, maxRelativeError(closedForm, reference));
+    std::printf("加速比 %.1fx\n\n", quadratureMs / closedFormMs);
+
+    // 当前求解器的整条曲线耗时
+    ModelSolver01_06 solver(ModelSolver01_06::Model_1);
+    ModelParams params = TestModels::defaultParams(ModelSolver01_06::Model_1);
+    QVector<double> t = ModelSolver01_06::generateLogTimeSteps(40, -3.0, 3.0);
+    solver.calculateTheoreticalCurve(params, t);
+    QElapsedTimer timer;
+    timer.start();
+    int curves = 0;
+    do {
+        checksum += std::get<1>(solver.calculateTheoreticalCurve(params, t)).last();
+        ++curves;
+    } while (timer.nsecsElapsed() * 1e-6 < minMs);
+    std::printf("Model_1 理论曲线 (40 点): %.2f ms/条\n", timer.nsecsElapsed() * 1e-6 / curves);
+
+    std::printf("(校验和 %.6e)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,10 @@
+# ----------------------------------------------------
+# 线源积分基准: 闭式 Ki1 积分 vs 原自适应 Gauss 积分
+# ----------------------------------------------------
+
+TEMPLATE = app
+TARGET = bench_linesource
+
+include(../../solvercore.pri)
+
+SOURCES += bench_linesource.cpp
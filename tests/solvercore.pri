@@ -0,0 +1,65 @@
+# ----------------------------------------------------
+# 求解器核心源文件 (不含界面)
+# 供 tests/ 下的测试与基准工程共用；主工程 WellTest.pro 单独列出全部源文件，
+# 求解器增删文件时两处需同步修改
+# ----------------------------------------------------
+
+QT += core concurrent
+QT -= gui
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+# 编译优化选项 (与主工程一致，基准耗时才有可比性)
+QMAKE_CXXFLAGS += -O3
+QMAKE_CXXFLAGS_RELEASE -= -O2
+QMAKE_CXXFLAGS_RELEASE += -O3
+QMAKE_CXXFLAGS_WARN_ON += -Wno-unused-parameter
+
+unix: LIBS += -lm
+win32: LIBS += -lm
+
+# Eigen 矩阵库
+INCLUDEPATH += D:/08YYYXXX/eigen-3.3.8
+
+# Boost 库
+INCLUDEPATH += D:/08YYYXXX/boost_1_89_0
+
+ROOT = $$PWD/..
+INCLUDEPATH += $$ROOT $$PWD
+
+HEADERS += \
+           $$ROOT/accuracyprofile.h \
+           $$ROOT/besselbatch.h \
+           $$ROOT/complexbessel.h \
+           $$ROOT/fitengine.h \
+           $$ROOT/fracturegeometry.h \
+           $$ROOT/hmatrix.h \
+           $$ROOT/laplaceinversion.h \
+           $$ROOT/linesourceintegral.h \
+           $$ROOT/logloginterpolator.h \
+           $$ROOT/lrucache.h \
+           $$ROOT/modelparams.h \
+           $$ROOT/modelsolver01-06.h \
+           $$ROOT/reservoirresponsecache.h \
+           $$ROOT/solverstats.h \
+           $$ROOT/solverworkspace.h \
+           $$ROOT/typecurvecache.h \
+           $$PWD/testmodels.h
+
+SOURCES += \
+           $$ROOT/accuracyprofile.cpp \
+           $$ROOT/besselbatch.cpp \
+           $$ROOT/complexbessel.cpp \
+           $$ROOT/fitengine.cpp \
+           $$ROOT/fracturegeometry.cpp \
+           $$ROOT/hmatrix.cpp \
+           $$ROOT/laplaceinversion.cpp \
+           $$ROOT/linesourceintegral.cpp \
+           $$ROOT/logloginterpolator.cpp \
+           $$ROOT/modelparams.cpp \
+           $$ROOT/modelsolver01-06.cpp \
+           $$ROOT/reservoirresponsecache.cpp \
+           $$ROOT/solverstats.cpp \
+           $$ROOT/solverworkspace.cpp \
+           $$ROOT/typecurvecache.cpp
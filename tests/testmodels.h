@@ -0,0 +1,53 @@
+/*
+ * testmodels.h
+ * 文件作用: 测试与基准程序共用的模型参数
+ * 功能描述:
+ * 1. 给出六类模型的缺省参数块，与 ModelManager::getDefaultParameters 一致 (基本参数取 ModelParameter 的缺省值)。
+ * 2. 测试工程不链接界面代码，因此不能直接调用 ModelManager，在此单独列出。
+ */
+
+#ifndef TESTMODELS_H
+#define TESTMODELS_H
+
+#include <QMap>
+#include <QString>
+#include "modelsolver01-06.h"
+
+namespace TestModels {
+
+const int kModelCount = 6;
+
+inline ModelParams defaultParams(ModelSolver01_06::ModelType type)
+{
+    QMap<QString, double> p;
+    p.insert("phi", 0.05);
+    p.insert("h", 20.0);
+    p.insert("mu", 0.5);
+    p.insert("B", 1.05);
+    p.insert("Ct", 5e-4);
+    p.insert("q", 50.0);
+
+    p.insert("nf", 4.0);
+    p.insert("kf", 1e-3);
+    p.insert("km", 1e-4);
+    p.insert("L", 1000.0);
+    p.insert("Lf", 100.0);
+    p.insert("LfD", 0.1);
+    p.insert("rmD", 4.0);
+    p.insert("omega1", 0.4);
+    p.insert("omega2", 0.08);
+    p.insert("lambda1", 1e-3);
+    p.insert("gamaD", 0.02);
+
+    bool variableStorage = (type == ModelSolver01_06::Model_1 || type == ModelSolver01_06::Model_3 || type == ModelSolver01_06::Model_5);
+    p.insert("cD", variableStorage ? 0.01 : 0.0);
+    p.insert("S", variableStorage ? 1.0 : 0.0);
+
+    if (type != ModelSolver01_06::Model_1 && type != ModelSolver01_06::Model_2) p.insert("reD", 10.0);
+
+    return ModelParams::fromMap(p);
+}
+
+} // namespace TestModels
+
+#endif // TESTMODELS_H
@@ -0,0 +1,12 @@
+# ----------------------------------------------------
+# Project: WellTest tests
+# Description: 求解器测试与基准程序 (不含界面代码)
+#   auto/       自动测试，make check 运行，失败时返回非零
+#   benchmarks/ 基准程序，手动运行并查看输出
+# ----------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+           auto \
+           benchmarks
@@ -0,0 +1,15 @@
+/*
+ * typecurvecache.cpp
+ * 文件作用: 无因次典型曲线缓存实现
+ * 功能描述:
+ * 1. 以字节串键 (无因次参数与选项的原始二进制) 索引曲线，保证只有完全相同的无因次问题才会命中。
+ * 2. 查找、插入与淘汰由 LruCache 实现，此处只提供全局共享实例。
+ */
+
+#include "typecurvecache.h"
+
+TypeCurveCache& TypeCurveCache::shared()
+{
+    static TypeCurveCache cache;
+    return cache;
+}
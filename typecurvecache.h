@@ -0,0 +1,39 @@
+/*
+ * typecurvecache.h
+ * 文件作用: 无因次典型曲线缓存头文件
+ * 功能描述:
+ * 1. 缓存稠密对数 tD 网格上的无因次压力 pD(tD) 与导数曲线 (双对数单调三次插值)。
+ * 2. 缓存键只包含无因次参数与求解选项，渗透率、孔隙度、粘度、产量等物理参数只通过
+ *    tD 平移与压力缩放起作用，修改它们时只需插值与缩放，无需重新反演。
+ * 3. 全局共享、线程安全，按最近使用顺序淘汰 (LruCache)。
+ */
+
+#ifndef TYPECURVECACHE_H
+#define TYPECURVECACHE_H
+
+#include "lrucache.h"
+#include "logloginterpolator.h"
+
+// 一条无因次典型曲线
+struct TypeCurve {
+    LogLogInterpolator pd;    // pD(tD)
+    LogLogInterpolator deriv; // dpD/dln(tD)
+
+    // 网格是否覆盖 [tDMin, tDMax]
+    bool covers(double tDMin, double tDMax) const {
+        return pd.isValid() && tDMin >= pd.xMin() && tDMax <= pd.xMax();
+    }
+};
+
+// 典型曲线缓存，容量按曲线条数计 (默认 64 条)
+class TypeCurveCache : public LruCache<TypeCurve>
+{
+public:
+    // 全局共享实例
+    static TypeCurveCache& shared();
+
+private:
+    TypeCurveCache() : LruCache<TypeCurve>(64) {}
+};
+
+#endif // TYPECURVECACHE_H
@@ -34,7 +34,6 @@
 #include <QJsonArray>
 #include <QDateTime>
 #include <QBuffer>
-#include <Eigen/Dense>
 
 // 构造函数：初始化界面、图表和信号连接
 FittingWidget::FittingWidget(QWidget *parent) :
@@ -82,6 +81,7 @@ FittingWidget::FittingWidget(QWidget *parent) :
     connect(this, &FittingWidget::sigIterationUpdated, this, &FittingWidget::onIterationUpdate, Qt::QueuedConnection);
     connect(this, &FittingWidget::sigProgress, ui->progressBar, &QProgressBar::setValue);
     connect(&m_watcher, &QFutureWatcher<void>::finished, this, &FittingWidget::onFitFinished);
+    connect(&m_calibrationWatcher, &QFutureWatcher<AccuracyTuner::Result>::finished, this, &FittingWidget::onCalibrationFinished);
 
     // 连接权重滑块信号
     connect(ui->sliderWeight, &QSlider::valueChanged, this, &FittingWidget::onSliderWeightChanged);
@@ -90,6 +90,17 @@ FittingWidget::FittingWidget(QWidget *parent) :
     ui->sliderWeight->setRange(0, 100);
     ui->sliderWeight->setValue(50);
     onSliderWeightChanged(50);
+
+    // 拟合算法选项 (条目数据为 FitEngine 的枚举值，首项为默认)
+    ui->cmbFitStrategy->addItem("LM 迭代", (int)FitEngine::Strategy::LevenbergMarquardt);
+    ui->cmbFitStrategy->addItem("LM (Nielsen 阻尼)", (int)FitEngine::Strategy::Nielsen);
+    ui->cmbFitStrategy->addItem("LM (测地线加速)", (int)FitEngine::Strategy::Geodesic);
+    ui->cmbFitStrategy->addItem("信赖域折线法", (int)FitEngine::Strategy::Dogleg);
+    ui->cmbStepSolver->addItem("LDLT 分解", (int)FitEngine::StepSolver::Cholesky);
+    ui->cmbStepSolver->addItem("QR 分解 (病态问题)", (int)FitEngine::StepSolver::QR);
+    ui->cmbStepSolver->addItem("SVD 分解 (最稳健)", (int)FitEngine::StepSolver::SVD);
+    ui->cmbJacobianUpdate->addItem("每次差分", (int)FitEngine::JacobianUpdate::FiniteDifference);
+    ui->cmbJacobianUpdate->addItem("Broyden 修正", (int)FitEngine::JacobianUpdate::Broyden);
 }
 
 // 析构函数：清理资源
@@ -339,33 +350,103 @@ void FittingWidget::on_btnSelectParams_clicked()
     }
 }
 
+// 标定拟合精度档位: 在当前参数与观测时间上选出满足目标误差且代价最小的设置，之后的拟合均使用该设置；
+// 标定要在各档位与反演阶数上多次求解，在后台线程执行 (与拟合相同)，期间标定与拟合按钮不可用
+void FittingWidget::on_btnCalibrateAccuracy_clicked() {
+    if(m_isFitting || m_calibrationWatcher.isRunning()) return;
+    if(m_obsTime.isEmpty()) {
+        QMessageBox::warning(this,"错误","请先加载观测数据。");
+        return;
+    }
+
+    ModelParams modelParams = ModelParams::fromMap(currentParameterValues());
+    modelParams.geometry = ModelParameter::instance()->getFractureGeometry();
+    ModelManager::ModelType type = m_currentModelType;
+    QVector<double> times = m_obsTime;
+
+    ui->btnCalibrateAccuracy->setEnabled(false);
+    ui->btnRunFit->setEnabled(false);
+    m_calibrationWatcher.setFuture(QtConcurrent::run([type, modelParams, times]() {
+        ModelSolver01_06 solver(type);
+        return AccuracyTuner::calibrate(solver, modelParams, times, AccuracyProfile::Fit);
+    }));
+}
+
+// 标定完成槽函数: 保存选出的设置并显示结果
+void FittingWidget::onCalibrationFinished() {
+    ui->btnCalibrateAccuracy->setEnabled(true);
+    ui->btnRunFit->setEnabled(true);
+    AccuracyTuner::Result r = m_calibrationWatcher.result();
+    AccuracyProfiles::setSettings(AccuracyProfile::Fit, r.settings);
+
+    QString text = QString("拟合精度: %1\n相对误差 %2 (目标 %3)\n代价 %4 (参考解 %5)，候选 %6 组，单次求解 %7 ms")
+                       .arg(r.settings.describe())
+                       .arg(r.error, 0, 'e', 2).arg(r.settings.targetError, 0, 'e', 0)
+                       .arg(r.cost, 0, 'f', 0).arg(r.referenceCost, 0, 'f', 0)
+                       .arg(r.candidates).arg(r.elapsedMs, 0, 'f', 1);
+    if(r.met) QMessageBox::information(this, "标定精度", text);
+    else QMessageBox::warning(this, "标定精度", "没有候选设置满足目标误差，已选用误差最小的一组。\n" + text);
+}
+
 // 执行拟合
 void FittingWidget::on_btnRunFit_clicked() {
-    if(m_isFitting) return;
+    if(m_isFitting || m_calibrationWatcher.isRunning()) return;
     if(m_obsTime.isEmpty()) {
         QMessageBox::warning(this,"错误","请先加载观测数据。");
         return;
     }
 
     m_paramChart->updateParamsFromTable();
+    // 勾选拟合的参数必须都能传给求解器，否则该参数实际不会变化
+    QStringList unmapped = FitEngine::unmappedParameters(m_paramChart->getParameters());
+    if(!unmapped.isEmpty()) {
+        QStringList names;
+        for(const auto& p : m_paramChart->getParameters()) {
+            if(unmapped.contains(p.name)) names.append(QString("%1 (%2)").arg(p.displayName, p.name));
+        }
+        QMessageBox::warning(this, "错误", "以下参数无法参与当前模型的拟合，请取消勾选后重试:\n" + names.join("\n"));
+        return;
+    }
+    // 项目设置了裂缝几何时求解器按几何计算，裂缝数与裂缝半长不起作用
+    QStringList overridden = FitEngine::geometryParameters(m_paramChart->getParameters(), ModelParameter::instance()->getFractureGeometry());
+    if(!overridden.isEmpty()) {
+        QStringList names;
+        for(const auto& p : m_paramChart->getParameters()) {
+            if(overridden.contains(p.name)) names.append(QString("%1 (%2)").arg(p.displayName, p.name));
+        }
+        QMessageBox::warning(this, "错误", "项目已设置裂缝几何，求解器按几何中的裂缝段计算，以下参数不起作用，请取消勾选后重试:\n" + names.join("\n"));
+        return;
+    }
+
     m_isFitting = true;
-    m_stopRequested = false;
     ui->btnRunFit->setEnabled(false);
-
-    // 准备拟合参数
-    ModelManager::ModelType modelType = m_currentModelType;
-    QList<FitParameter> paramsCopy = m_paramChart->getParameters();
-    double w = ui->sliderWeight->value() / 100.0;
+    m_fitStats.reset();
+
+    // 准备拟合引擎: 观测数据、参数表、权重与裂缝几何在启动前复制，拟合线程不访问界面数据
+    QSharedPointer<FitEngine> engine(new FitEngine(m_currentModelType));
+    engine->setObservedData(m_obsTime, m_obsDeltaP, m_obsDerivative);
+    engine->setParameters(m_paramChart->getParameters());
+    engine->setWeight(ui->sliderWeight->value() / 100.0);
+    engine->setStrategy((FitEngine::Strategy)ui->cmbFitStrategy->currentData().toInt());
+    engine->setStepSolver((FitEngine::StepSolver)ui->cmbStepSolver->currentData().toInt());
+    engine->setJacobianUpdate((FitEngine::JacobianUpdate)ui->cmbJacobianUpdate->currentData().toInt());
+    engine->setGeometry(ModelParameter::instance()->getFractureGeometry());
+    engine->setSolverStats(&m_fitStats);
+    engine->setIterationCallback([this](const FitEngine::Iteration& it) {
+        emit sigIterationUpdated(it.error, it.params, std::get<0>(it.curve), std::get<1>(it.curve), std::get<2>(it.curve));
+    });
+    engine->setProgressCallback([this](int percent) { emit sigProgress(percent); });
+    m_fitEngine = engine;
 
     // 启动异步线程执行拟合任务，避免阻塞 UI
-    m_watcher.setFuture(QtConcurrent::run([this, modelType, paramsCopy, w](){
-        runOptimizationTask(modelType, paramsCopy, w);
+    m_watcher.setFuture(QtConcurrent::run([this, engine](){
+        runOptimizationTask(engine);
     }));
 }
 
 // 停止拟合
 void FittingWidget::on_btnStop_clicked() {
-    m_stopRequested = true;
+    if (m_fitEngine) m_fitEngine->requestStop();
 }
 
 // 导入模型参数（实际上是刷新曲线）
@@ -518,260 +599,12 @@ void FittingWidget::onExportCurveData() {
     }
 }
 
-// 运行优化任务的包装函数
-void FittingWidget::runOptimizationTask(ModelManager::ModelType modelType, QList<FitParameter> fitParams, double weight) {
-    runLevenbergMarquardtOptimization(modelType, fitParams, weight);
-}
-
-// Levenberg-Marquardt 算法实现
-void FittingWidget::runLevenbergMarquardtOptimization(ModelManager::ModelType modelType, QList<FitParameter> params, double weight) {
-    // 降低 Solver 精度以提高拟合速度
-    if(m_modelManager) m_modelManager->setHighPrecision(false);
-
-    // 找出需要拟合的参数索引
-    QVector<int> fitIndices;
-    for(int i=0; i<params.size(); ++i) {
-        if(params[i].isFit) fitIndices.append(i);
-    }
-    int nParams = fitIndices.size();
-
-    // 如果没有选定拟合参数，直接返回
-    if(nParams == 0) {
-        QMetaObject::invokeMethod(this, "onFitFinished");
-        return;
-    }
-
-    // LM 算法参数初始化
-    double lambda = 0.01;
-    int maxIter = 50;
-    double currentSSE = 1e15;
-
-    // 构建参数映射
-    QMap<QString, double> currentParamMap;
-    for(const auto& p : params) currentParamMap.insert(p.name, p.value);
-
-    // 处理复合参数（如裂缝穿透比 LfD）
-    if(currentParamMap.contains("L") && currentParamMap.contains("Lf") && currentParamMap["L"] > 1e-9)
-        currentParamMap["LfD"] = currentParamMap["Lf"] / currentParamMap["L"];
-
-    // 计算初始残差
-    QVector<double> residuals = calculateResiduals(currentParamMap, modelType, weight);
-    currentSSE = calculateSumSquaredError(residuals);
-
-    // 发送初始状态信号
-    ModelCurveData curve = m_modelManager->calculateTheoreticalCurve(modelType, currentParamMap);
-    emit sigIterationUpdated(currentSSE/residuals.size(), currentParamMap, std::get<0>(curve), std::get<1>(curve), std::get<2>(curve));
-
-    // 迭代循环
-    for(int iter = 0; iter < maxIter; ++iter) {
-        if(m_stopRequested) break;
-        // 收敛条件判断
-        if (!residuals.isEmpty() && (currentSSE / residuals.size()) < 3e-3) break;
-
-        emit sigProgress(iter * 100 / maxIter);
-
-        // 计算雅可比矩阵 J
-        QVector<QVector<double>> J = computeJacobian(currentParamMap, residuals, fitIndices, modelType, params, weight);
-        int nRes = residuals.size();
-
-        // 计算 H = J^T * J 和 g = J^T * r
-        QVector<QVector<double>> H(nParams, QVector<double>(nParams, 0.0));
-        QVector<double> g(nParams, 0.0);
-
-        for(int k=0; k<nRes; ++k) {
-            for(int i=0; i<nParams; ++i) {
-                g[i] += J[k][i] * residuals[k];
-                for(int j=0; j<=i; ++j) {
-                    H[i][j] += J[k][i] * J[k][j];
-                }
-            }
-        }
-        // 对称填充 H 矩阵
-        for(int i=0; i<nParams; ++i) {
-            for(int j=i+1; j<nParams; ++j) {
-                H[i][j] = H[j][i];
-            }
-        }
-
-        bool stepAccepted = false;
-        // 尝试更新步骤
-        for(int tryIter=0; tryIter<5; ++tryIter) {
-            // H_lm = H + lambda * I
-            QVector<QVector<double>> H_lm = H;
-            for(int i=0; i<nParams; ++i) {
-                H_lm[i][i] += lambda * (1.0 + std::abs(H[i][i]));
-            }
-
-            QVector<double> negG(nParams);
-            for(int i=0;i<nParams;++i) negG[i] = -g[i];
-
-            // 求解线性方程组 H_lm * delta = -g
-            QVector<double> delta = solveLinearSystem(H_lm, negG);
-            QMap<QString, double> trialMap = currentParamMap;
-
-            // 更新参数值
-            for(int i=0; i<nParams; ++i) {
-                int pIdx = fitIndices[i];
-                QString pName = params[pIdx].name;
-                double oldVal = currentParamMap[pName];
-                // 对数敏感参数进行对数空间更新
-                bool isLog = (oldVal > 1e-12 && pName != "S" && pName != "nf");
-                double newVal;
-
-                if(isLog) newVal = pow(10.0, log10(oldVal) + delta[i]);
-                else newVal = oldVal + delta[i];
-
-                // 约束参数范围
-                newVal = qMax(params[pIdx].min, qMin(newVal, params[pIdx].max));
-                trialMap[pName] = newVal;
-            }
-
-            // 更新依赖参数
-            if(trialMap.contains("L") && trialMap.contains("Lf") && trialMap["L"] > 1e-9)
-                trialMap["LfD"] = trialMap["Lf"] / trialMap["L"];
-
-            // 计算新误差
-            QVector<double> newRes = calculateResiduals(trialMap, modelType, weight);
-            double newSSE = calculateSumSquaredError(newRes);
-
-            // 如果误差减小，接受步长并减小 lambda
-            if(newSSE < currentSSE) {
-                currentSSE = newSSE;
-                currentParamMap = trialMap;
-                residuals = newRes;
-                lambda /= 10.0;
-                stepAccepted = true;
-                ModelCurveData iterCurve = m_modelManager->calculateTheoreticalCurve(modelType, currentParamMap);
-                emit sigIterationUpdated(currentSSE/nRes, currentParamMap, std::get<0>(iterCurve), std::get<1>(iterCurve), std::get<2>(iterCurve));
-                break;
-            } else {
-                // 否则增大 lambda 增加阻尼
-                lambda *= 10.0;
-            }
-        }
-        if(!stepAccepted && lambda > 1e10) break;
+// 后台线程中执行拟合: 引擎回调转发为界面信号 (排队连接)，结束后发送最终曲线；完成处理由 m_watcher 的 finished 信号触发
+void FittingWidget::runOptimizationTask(const QSharedPointer<FitEngine>& engine) {
+    FitEngine::Result result = engine->run();
+    if (result.fittedCount > 0) {
+        emit sigIterationUpdated(result.error, result.params, std::get<0>(result.curve), std::get<1>(result.curve), std::get<2>(result.curve));
     }
-
-    // 恢复高精度计算
-    if(m_modelManager) m_modelManager->setHighPrecision(true);
-
-    // 最终更新一次界面
-    if(currentParamMap.contains("L") && currentParamMap.contains("Lf") && currentParamMap["L"] > 1e-9)
-        currentParamMap["LfD"] = currentParamMap["Lf"] / currentParamMap["L"];
-
-    ModelCurveData finalCurve = m_modelManager->calculateTheoreticalCurve(modelType, currentParamMap);
-    emit sigIterationUpdated(currentSSE/residuals.size(), currentParamMap, std::get<0>(finalCurve), std::get<1>(finalCurve), std::get<2>(finalCurve));
-
-    QMetaObject::invokeMethod(this, "onFitFinished");
-}
-
-// 计算残差向量
-QVector<double> FittingWidget::calculateResiduals(const QMap<QString, double>& params, ModelManager::ModelType modelType, double weight) {
-    if(!m_modelManager || m_obsTime.isEmpty()) return QVector<double>();
-
-    // 调用 Manager 接口计算理论曲线
-    ModelCurveData res = m_modelManager->calculateTheoreticalCurve(modelType, params, m_obsTime);
-    const QVector<double>& pCal = std::get<1>(res);
-    const QVector<double>& dpCal = std::get<2>(res);
-
-    QVector<double> r;
-    double wp = weight;
-    double wd = 1.0 - weight;
-
-    // 计算压差残差 (对数差值)
-    int count = qMin(m_obsDeltaP.size(), pCal.size());
-    for(int i=0; i<count; ++i) {
-        if(m_obsDeltaP[i] > 1e-10 && pCal[i] > 1e-10)
-            r.append( (log(m_obsDeltaP[i]) - log(pCal[i])) * wp );
-        else
-            r.append(0.0);
-    }
-
-    // 计算导数残差 (对数差值)
-    int dCount = qMin(m_obsDerivative.size(), dpCal.size());
-    dCount = qMin(dCount, count);
-    for(int i=0; i<dCount; ++i) {
-        if(m_obsDerivative[i] > 1e-10 && dpCal[i] > 1e-10)
-            r.append( (log(m_obsDerivative[i]) - log(dpCal[i])) * wd );
-        else
-            r.append(0.0);
-    }
-    return r;
-}
-
-// 计算雅可比矩阵（有限差分法）
-QVector<QVector<double>> FittingWidget::computeJacobian(const QMap<QString, double>& params, const QVector<double>& baseResiduals, const QVector<int>& fitIndices, ModelManager::ModelType modelType, const QList<FitParameter>& currentFitParams, double weight) {
-    int nRes = baseResiduals.size();
-    int nParams = fitIndices.size();
-    QVector<QVector<double>> J(nRes, QVector<double>(nParams));
-
-    for(int j = 0; j < nParams; ++j) {
-        int idx = fitIndices[j];
-        QString pName = currentFitParams[idx].name;
-        double val = params.value(pName);
-        bool isLog = (val > 1e-12 && pName != "S" && pName != "nf");
-
-        double h;
-        QMap<QString, double> pPlus = params;
-        QMap<QString, double> pMinus = params;
-
-        // 确定扰动步长 h
-        if(isLog) {
-            h = 0.01;
-            double valLog = log10(val);
-            pPlus[pName] = pow(10.0, valLog + h);
-            pMinus[pName] = pow(10.0, valLog - h);
-        } else {
-            h = 1e-4;
-            pPlus[pName] = val + h;
-            pMinus[pName] = val - h;
-        }
-
-        // 联动更新依赖参数
-        auto updateDeps = [](QMap<QString,double>& map) { if(map.contains("L") && map.contains("Lf") && map["L"] > 1e-9) map["LfD"] = map["Lf"] / map["L"]; };
-        if(pName == "L" || pName == "Lf") { updateDeps(pPlus); updateDeps(pMinus); }
-
-        QVector<double> rPlus = calculateResiduals(pPlus, modelType, weight);
-        QVector<double> rMinus = calculateResiduals(pMinus, modelType, weight);
-
-        if(rPlus.size() == nRes && rMinus.size() == nRes) {
-            for(int i=0; i<nRes; ++i) {
-                // 中心差分公式
-                J[i][j] = (rPlus[i] - rMinus[i]) / (2.0 * h);
-            }
-        }
-    }
-    return J;
-}
-
-// 求解线性方程组 (Ax = b) 使用 Eigen 库
-QVector<double> FittingWidget::solveLinearSystem(const QVector<QVector<double>>& A, const QVector<double>& b) {
-    int n = b.size();
-    if (n == 0) return QVector<double>();
-
-    Eigen::MatrixXd matA(n, n);
-    Eigen::VectorXd vecB(n);
-
-    for (int i = 0; i < n; ++i) {
-        vecB(i) = b[i];
-        for (int j = 0; j < n; ++j) {
-            matA(i, j) = A[i][j];
-        }
-    }
-
-    // 使用 LDLT 分解求解
-    Eigen::VectorXd x = matA.ldlt().solve(vecB);
-
-    QVector<double> res(n);
-    for (int i = 0; i < n; ++i) res[i] = x(i);
-    return res;
-}
-
-// 计算误差平方和
-double FittingWidget::calculateSumSquaredError(const QVector<double>& residuals) {
-    double sse = 0.0;
-    for(double v : residuals) sse += v*v;
-    return sse;
 }
 
 // 更新界面上的理论曲线
@@ -782,6 +615,25 @@ void FittingWidget::updateModelCurve() {
     }
     ui->tableParams->clearFocus();
 
+    QMap<QString,double> currentParams = currentParameterValues();
+
+    ModelManager::ModelType type = m_currentModelType;
+    QVector<double> targetT = m_obsTime;
+    // 如果没有观测时间，则生成默认的时间序列
+    if(targetT.isEmpty()) {
+        for(double e = -4; e <= 4; e += 0.1) targetT.append(pow(10, e));
+    }
+
+    SolverOptions options;
+    options.coarseGridTolerance = 1e-5; // 观测点很多时先在粗网格上求解再插值
+    ModelParams modelParams = ModelParams::fromMap(currentParams);
+    modelParams.geometry = ModelParameter::instance()->getFractureGeometry();
+    ModelCurveData res = m_modelManager->calculateTheoreticalCurve(type, modelParams, targetT, options);
+    onIterationUpdate(0, currentParams, std::get<0>(res), std::get<1>(res), std::get<2>(res));
+}
+
+// 参数表的当前值 (含依赖参数 LfD)
+QMap<QString,double> FittingWidget::currentParameterValues() {
     m_paramChart->updateParamsFromTable();
     QList<FitParameter> params = m_paramChart->getParameters();
 
@@ -793,16 +645,7 @@ void FittingWidget::updateModelCurve() {
         currentParams["LfD"] = currentParams["Lf"] / currentParams["L"];
     else
         currentParams["LfD"] = 0.0;
-
-    ModelManager::ModelType type = m_currentModelType;
-    QVector<double> targetT = m_obsTime;
-    // 如果没有观测时间，则生成默认的时间序列
-    if(targetT.isEmpty()) {
-        for(double e = -4; e <= 4; e += 0.1) targetT.append(pow(10, e));
-    }
-
-    ModelCurveData res = m_modelManager->calculateTheoreticalCurve(type, currentParams, targetT);
-    onIterationUpdate(0, currentParams, std::get<0>(res), std::get<1>(res), std::get<2>(res));
+    return currentParams;
 }
 
 // 迭代更新槽函数：刷新误差显示和图表
@@ -829,6 +672,16 @@ void FittingWidget::onIterationUpdate(double err, const QMap<QString,double>& p,
 void FittingWidget::onFitFinished() {
     m_isFitting = false;
     ui->btnRunFit->setEnabled(true);
+    // 状态区显示本次拟合的求解统计 (完整内容见提示)；误差文本先去掉上次拟合附加的统计
+    QString fitAccuracy = QString("拟合精度: %1").arg(AccuracyProfiles::settings(AccuracyProfile::Fit).describe());
+    if (SolverStats::compiledIn() && m_fitStats.curves > 0) {
+        QString errorText = ui->label_Error->text().section("  [", 0, 0);
+        ui->label_Error->setText(errorText + QString("  [曲线 %1 条, 拉氏求值 %2 次, 求解耗时 %3 s]")
+                                 .arg(m_fitStats.curves).arg(m_fitStats.laplaceEvaluations).arg(m_fitStats.totalMs / 1000.0, 0, 'f', 2));
+        ui->label_Error->setToolTip(m_fitStats.summary() + "\n" + fitAccuracy);
+    } else {
+        ui->label_Error->setToolTip(fitAccuracy);
+    }
     QMessageBox::information(this, "完成", "拟合完成。");
 }
 
@@ -976,6 +829,9 @@ QJsonObject FittingWidget::getJsonState() const
     root["modelType"] = (int)m_currentModelType;
     root["modelName"] = ModelManager::getModelTypeName(m_currentModelType);
     root["fitWeightVal"] = ui->sliderWeight->value();
+    root["fitStrategy"] = ui->cmbFitStrategy->currentData().toInt();
+    root["fitStepSolver"] = ui->cmbStepSolver->currentData().toInt();
+    root["fitJacobianUpdate"] = ui->cmbJacobianUpdate->currentData().toInt();
 
     QJsonObject plotRange;
     plotRange["xMin"] = m_plot->xAxis->range().lower;
@@ -1057,6 +913,15 @@ void FittingWidget::loadFittingState(const QJsonObject& root)
         ui->sliderWeight->setValue((int)(w * 100));
     }
 
+    // 拟合算法选项 (旧项目没有时保持默认)
+    auto restoreOption = [&root](QComboBox* combo, const char* key) {
+        int index = root.contains(key) ? combo->findData(root[key].toInt()) : -1;
+        combo->setCurrentIndex(index >= 0 ? index : 0);
+    };
+    restoreOption(ui->cmbFitStrategy, "fitStrategy");
+    restoreOption(ui->cmbStepSolver, "fitStepSolver");
+    restoreOption(ui->cmbJacobianUpdate, "fitJacobianUpdate");
+
     if (root.contains("observedData")) {
         QJsonObject obs = root["observedData"].toObject();
         QJsonArray tArr = obs["time"].toArray();
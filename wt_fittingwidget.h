@@ -3,7 +3,7 @@
  * 文件作用: 试井拟合分析主界面类的头文件
  * 功能描述:
  * 1. 定义拟合分析界面的主要控件成员变量和布局逻辑。
- * 2. 声明用于Levenberg-Marquardt非线性回归拟合的核心算法函数。
+ * 2. 组织 FitEngine (Levenberg-Marquardt 非线性回归) 在后台线程执行拟合，并把迭代状态显示到界面。
  * 3. 声明观测数据（时间、压差、导数）的管理函数。
  * 4. 集成 ChartWidget 以统一图表显示和交互体验。
  */
@@ -22,6 +22,7 @@
 #include "chartwidget.h"  // [新增] 引入图表组件头文件
 #include "fittingparameterchart.h"
 #include "paramselectdialog.h"
+#include "fitengine.h"
 
 namespace Ui { class FittingWidget; }
 
@@ -69,6 +70,7 @@ private slots:
     // 拟合控制
     void on_btnRunFit_clicked();
     void on_btnStop_clicked();
+    void on_btnCalibrateAccuracy_clicked(); // 按当前参数标定拟合精度档位
     void on_btnImportModel_clicked();
 
     // 结果导出
@@ -82,6 +84,7 @@ private slots:
     // 内部拟合逻辑槽函数
     void onIterationUpdate(double err, const QMap<QString,double>& p, const QVector<double>& t, const QVector<double>& p_curve, const QVector<double>& d_curve);
     void onFitFinished();
+    void onCalibrationFinished();
     void onSliderWeightChanged(int value);
 
 private:
@@ -107,8 +110,14 @@ private:
 
     // 拟合状态控制
     bool m_isFitting;
-    bool m_stopRequested;
     QFutureWatcher<void> m_watcher;
+    // 精度标定在后台线程执行，完成处理由其 finished 信号触发
+    QFutureWatcher<AccuracyTuner::Result> m_calibrationWatcher;
+    // 当前拟合的引擎 (停止按钮向其发出停止请求)
+    QSharedPointer<FitEngine> m_fitEngine;
+
+    // 本次拟合的求解统计 (启动拟合时清零，拟合线程累加，结束后显示在状态区)
+    SolverStats m_fitStats;
 
     // 初始化图表设置
     void setupPlot();
@@ -116,14 +125,11 @@ private:
     void initializeDefaultModel();
     // 更新模型曲线
     void updateModelCurve();
+    // 参数表的当前值 (含依赖参数 LfD)
+    QMap<QString,double> currentParameterValues();
 
-    // 核心拟合算法函数 (Levenberg-Marquardt)
-    void runOptimizationTask(ModelManager::ModelType modelType, QList<FitParameter> fitParams, double weight);
-    void runLevenbergMarquardtOptimization(ModelManager::ModelType modelType, QList<FitParameter> params, double weight);
-    QVector<double> calculateResiduals(const QMap<QString, double>& params, ModelManager::ModelType modelType, double weight);
-    QVector<QVector<double>> computeJacobian(const QMap<QString, double>& params, const QVector<double>& residuals, const QVector<int>& fitIndices, ModelManager::ModelType modelType, const QList<FitParameter>& currentFitParams, double weight);
-    QVector<double> solveLinearSystem(const QVector<QVector<double>>& A, const QVector<double>& b);
-    double calculateSumSquaredError(const QVector<double>& residuals);
+    // 后台线程中执行拟合引擎，并把最终结果通知界面
+    void runOptimizationTask(const QSharedPointer<FitEngine>& engine);
 
     // 辅助绘图函数
     QString getPlotImageBase64();
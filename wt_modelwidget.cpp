@@ -12,6 +12,7 @@
 #include "ui_wt_modelwidget.h"
 #include "modelmanager.h" // 仅用于获取项目路径等辅助功能
 #include "modelparameter.h"
+#include "fracturegeometrydialog.h"
 
 #include <QDebug>
 #include <QMessageBox>
@@ -25,7 +26,7 @@ WT_ModelWidget::WT_ModelWidget(ModelType type, QWidget *parent)
     : QWidget(parent)
     , ui(new Ui::WT_ModelWidget)
     , m_type(type)
-    , m_highPrecision(true)
+    , m_profile(AccuracyProfile::Report)
 {
     ui->setupUi(this);
 
@@ -47,6 +48,7 @@ WT_ModelWidget::WT_ModelWidget(ModelType type, QWidget *parent)
     initChart();
     setupConnections();
     onResetParameters();
+    updateFractureGeometryState();
 }
 
 WT_ModelWidget::~WT_ModelWidget()
@@ -59,19 +61,35 @@ QString WT_ModelWidget::getModelName() const {
     return ModelSolver01_06::getModelName(m_type);
 }
 
+// 界面计算使用的求解选项
+SolverOptions WT_ModelWidget::solverOptions()
+{
+    SolverOptions options = AccuracyProfiles::options(m_profile); // 阶数、积分与网格设置由精度档位决定
+    options.reservoirCache = true; // cD、S、gamaD 敏感性分析的各条曲线共用同一储层响应
+    options.stats = &m_lastStats;
+    return options;
+}
+
 // 转发给 Solver 进行计算
 WT_ModelWidget::ModelCurveData WT_ModelWidget::calculateTheoreticalCurve(const QMap<QString, double>& params, const QVector<double>& providedTime)
 {
     if (m_solver) {
-        return m_solver->calculateTheoreticalCurve(params, providedTime);
+        return m_solver->calculateTheoreticalCurve(params, providedTime, solverOptions());
     }
     return ModelCurveData();
 }
 
-void WT_ModelWidget::setHighPrecision(bool high)
+QVector<WT_ModelWidget::ModelCurveData> WT_ModelWidget::calculateTheoreticalCurves(const QVector<ModelParams>& paramSets, const QVector<double>& providedTime)
 {
-    m_highPrecision = high;
-    if (m_solver) m_solver->setHighPrecision(high);
+    if (m_solver) {
+        return m_solver->calculateTheoreticalCurves(paramSets, providedTime, solverOptions());
+    }
+    return QVector<ModelCurveData>(paramSets.size());
+}
+
+void WT_ModelWidget::setAccuracyProfile(AccuracyProfile profile)
+{
+    m_profile = profile;
 }
 
 void WT_ModelWidget::initUi() {
@@ -144,6 +162,7 @@ void WT_ModelWidget::setupConnections() {
 
     // [新增] 转发模型选择按钮信号
     connect(ui->btnSelectModel, &QPushButton::clicked, this, &WT_ModelWidget::requestModelSelection);
+    connect(ui->btnFractureGeometry, &QPushButton::clicked, this, &WT_ModelWidget::onEditFractureGeometry);
 }
 
 QVector<double> WT_ModelWidget::parseInput(const QString& text) {
@@ -205,6 +224,37 @@ void WT_ModelWidget::onResetParameters() {
     onDependentParamsChanged();
 }
 
+void WT_ModelWidget::updateFractureGeometryState() {
+    QSharedPointer<const FractureGeometry> geometry = ModelParameter::instance()->getFractureGeometry();
+    ui->btnFractureGeometry->setText(geometry ? QString("裂缝几何 (%1 段)...").arg(geometry->size()) : QString("裂缝几何..."));
+    QString tip = geometry ? QString("项目已设置裂缝几何 (%1 段)，按几何中的裂缝段计算，该参数不起作用").arg(geometry->size()) : QString();
+    for (QLineEdit* edit : { ui->nfEdit, ui->LfEdit, ui->LfDEdit }) {
+        edit->setEnabled(!geometry);
+        edit->setToolTip(tip);
+    }
+}
+
+void WT_ModelWidget::showEvent(QShowEvent* event) {
+    QWidget::showEvent(event);
+    updateFractureGeometryState();
+}
+
+// 编辑项目的裂缝几何 (裂缝段表格)，确认后随 .pwt 保存；模型计算与拟合均读取项目中的几何
+void WT_ModelWidget::onEditFractureGeometry() {
+    ModelParameter* mp = ModelParameter::instance();
+    if (!mp->hasLoadedProject()) {
+        QMessageBox::warning(this, "裂缝几何", "请先新建或打开项目，裂缝几何随项目文件保存");
+        return;
+    }
+    QSharedPointer<const FractureGeometry> current = mp->getFractureGeometry();
+    int nf = qMax(1, (int)parseInput(ui->nfEdit->text()).first());
+    double LfD = parseInput(ui->LfDEdit->text()).first();
+    FractureGeometryDialog dialog(current ? *current : FractureGeometry(), nf, LfD, this);
+    if (dialog.exec() != QDialog::Accepted) return;
+    mp->saveFractureGeometry(dialog.geometry());
+    updateFractureGeometryState();
+}
+
 void WT_ModelWidget::onDependentParamsChanged() {
     double L = parseInput(ui->LEdit->text()).first();
     double Lf = parseInput(ui->LfEdit->text()).first();
@@ -279,12 +329,19 @@ void WT_ModelWidget::runCalculation() {
     }
     bool isSensitivity = !sensitivityKey.isEmpty();
 
+    // 项目设置了裂缝几何时 nf 与裂缝半长不起作用，对其做敏感性分析只会得到相同的曲线
+    QSharedPointer<const FractureGeometry> geometry = ModelParameter::instance()->getFractureGeometry();
+    if(geometry && (sensitivityKey == "nf" || sensitivityKey == "Lf")) {
+        QMessageBox::warning(this, "敏感性分析", QString("项目已设置裂缝几何 (%1 段)，求解器按几何中的裂缝段计算，%2 不起作用。\n"
+                                                    "请只给 %2 填一个值，或先清空裂缝几何。").arg(geometry->size()).arg(sensitivityKey));
+        return;
+    }
+
     // 构建基础参数字典
     QMap<QString, double> baseParams;
     for(auto it = rawParams.begin(); it != rawParams.end(); ++it) {
         baseParams[it.key()] = it.value().isEmpty() ? 0.0 : it.value().first();
     }
-    baseParams["N"] = m_highPrecision ? 8.0 : 4.0;
     if(baseParams["L"] > 1e-9) baseParams["LfD"] = baseParams["Lf"] / baseParams["L"];
     else baseParams["LfD"] = 0;
 
@@ -304,7 +361,12 @@ void WT_ModelWidget::runCalculation() {
     QString resultTextHeader = QString("计算完成 (%1)\n").arg(getModelName());
     if(isSensitivity) resultTextHeader += QString("敏感性参数: %1\n").arg(sensitivityKey);
 
-    // 循环计算曲线
+    // 组装各条曲线的参数 (敏感性分析时每个取值一组)，一次批量计算
+    // 项目中设置了裂缝几何时按实际完井布置计算 (各曲线共享同一几何)
+    if(geometry) resultTextHeader += QString("裂缝几何: %1 段 (项目文件)\n").arg(geometry->size());
+
+    QVector<ModelParams> paramSets;
+    QVector<double> values;
     for(int i = 0; i < iterations; ++i) {
         QMap<QString, double> currentParams = baseParams;
         double val = 0;
@@ -315,9 +377,17 @@ void WT_ModelWidget::runCalculation() {
                 if(currentParams["L"] > 1e-9) currentParams["LfD"] = currentParams["Lf"] / currentParams["L"];
             }
         }
+        paramSets.append(ModelParams::fromMap(currentParams));
+        paramSets.last().geometry = geometry;
+        values.append(val);
+    }
+    m_lastStats.reset();
+    QVector<ModelCurveData> curves = calculateTheoreticalCurves(paramSets, t);
 
-        // 调用 Solver 计算
-        ModelCurveData res = calculateTheoreticalCurve(currentParams, t);
+    // 绘制曲线
+    for(int i = 0; i < curves.size(); ++i) {
+        const ModelCurveData& res = curves[i];
+        double val = values[i];
 
         // 缓存最后一次结果用于显示
         res_tD = std::get<0>(res);
@@ -334,6 +404,8 @@ void WT_ModelWidget::runCalculation() {
 
     // 更新结果文本
     QString resultText = resultTextHeader;
+    resultText += QString("精度档位: %1 (%2)\n").arg(AccuracyProfiles::name(m_profile), AccuracyProfiles::settings(m_profile).describe());
+    resultText += QString("求解统计: %1\n").arg(m_lastStats.summary());
     resultText += "t(h)\t\tDp(MPa)\t\tdDp(MPa)\n";
     for(int i=0; i<res_pD.size(); ++i) {
         resultText += QString("%1\t%2\t%3\n").arg(res_tD[i],0,'e',4).arg(res_pD[i],0,'e',4).arg(res_dpD[i],0,'e',4);
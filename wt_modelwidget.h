@@ -17,6 +17,7 @@
 #include <tuple>
 #include "chartwidget.h"
 #include "modelsolver01-06.h"
+#include "accuracyprofile.h"
 
 namespace Ui {
 class WT_ModelWidget;
@@ -35,10 +36,12 @@ public:
     explicit WT_ModelWidget(ModelType type, QWidget *parent = nullptr);
     ~WT_ModelWidget();
 
-    // 设置高精度模式（转发给 Solver）
-    void setHighPrecision(bool high);
+    // 设置界面计算使用的精度档位（随每次计算传给 Solver）
+    void setAccuracyProfile(AccuracyProfile profile);
     // 直接调用求解器计算（供外部管理器使用，非 UI 交互）
     ModelCurveData calculateTheoreticalCurve(const QMap<QString, double>& params, const QVector<double>& providedTime = QVector<double>());
+    // 批量计算多组参数的曲线 (敏感性分析)，共享时间序列并统一并行
+    QVector<ModelCurveData> calculateTheoreticalCurves(const QVector<ModelParams>& paramSets, const QVector<double>& providedTime = QVector<double>());
     // 获取当前模型名称
     QString getModelName() const;
 
@@ -54,26 +57,36 @@ public slots:
     void onDependentParamsChanged();
     void onShowPointsToggled(bool checked);
     void onExportData();
+    void onEditFractureGeometry();
 
 private:
     void initUi();
     void initChart();
     void setupConnections();
     void runCalculation(); // UI 触发的计算流程封装
+    SolverOptions solverOptions(); // 界面计算使用的求解选项 (统计记入 m_lastStats)
 
     // 辅助函数
     QVector<double> parseInput(const QString& text);
     void setInputText(QLineEdit* edit, double value);
     void plotCurve(const ModelCurveData& data, const QString& name, QColor color, bool isSensitivity);
+    // 按钮文字显示项目中裂缝几何的段数；设置了几何时 nf、Lf、LfD 不起作用，对应输入框不可用
+    void updateFractureGeometryState();
+
+protected:
+    void showEvent(QShowEvent* event) override; // 显示时同步项目的裂缝几何 (可能在其他模型页或打开项目时改变)
 
 private:
     Ui::WT_ModelWidget *ui;
     ModelType m_type;
     ModelSolver01_06* m_solver; // 数学模型求解器实例
 
-    bool m_highPrecision;
+    AccuracyProfile m_profile;
     QList<QColor> m_colorList;
 
+    // 最近一次计算的求解统计 (每次界面计算前清零，显示在结果文本中)
+    SolverStats m_lastStats;
+
     // 缓存计算结果
     QVector<double> res_tD;
     QVector<double> res_pD;